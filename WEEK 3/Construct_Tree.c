@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Node structure
+typedef struct Node {
+    int data;
+    struct Node *left;
+    struct Node *right;
+} Node;
+
+// All nodes of a rebuilt tree live in one allocation
+typedef struct {
+    Node* nodes;
+    int used;
+    int capacity;
+} NodeArena;
+
+// Open-addressing hash map: value -> position in the inorder array
+typedef struct {
+    int* keys;
+    int* positions; // -1 marks an empty slot
+    unsigned int mask;
+} PosIndex;
+
+// Pending subtree: where to link it and which slice of the sequences it covers
+typedef struct {
+    Node** slot;
+    int seqStart; // start in the preorder/postorder array
+    int inStart;  // start in the inorder array
+    int size;
+} Frame;
+
+// Hashes a value into the index table
+static unsigned int hashValue(int value, unsigned int mask) {
+    return ((unsigned int)value * 2654435761u) & mask;
+}
+
+// Largest table: the mask is an unsigned int, so 2^31 slots (n up to 2^30)
+#define POS_INDEX_MAX_SLOTS ((size_t)1 << 31)
+
+// Builds the inorder position index; returns 1, 0 on duplicate values, or
+// -1 if n is too large for the table
+int buildPosIndex(PosIndex* idx, const int* inorder, int n) {
+    idx->keys = NULL;
+    idx->positions = NULL;
+    size_t cap = 16;
+    while (cap < 2 * (size_t)n) {
+        if (cap == POS_INDEX_MAX_SLOTS) {
+            return -1;
+        }
+        cap <<= 1;
+    }
+    idx->keys = (int*)malloc(cap * sizeof(int));
+    idx->positions = (int*)malloc(cap * sizeof(int));
+    if (idx->keys == NULL || idx->positions == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    memset(idx->positions, -1, cap * sizeof(int));
+    idx->mask = (unsigned int)(cap - 1);
+
+    for (int i = 0; i < n; i++) {
+        unsigned int h = hashValue(inorder[i], idx->mask);
+        while (idx->positions[h] != -1) {
+            if (idx->keys[h] == inorder[i]) {
+                return 0;
+            }
+            h = (h + 1) & idx->mask;
+        }
+        idx->keys[h] = inorder[i];
+        idx->positions[h] = i;
+    }
+    return 1;
+}
+
+// Returns the inorder position of value, or -1 if it is absent
+int lookupPos(const PosIndex* idx, int value) {
+    unsigned int h = hashValue(value, idx->mask);
+    while (idx->positions[h] != -1) {
+        if (idx->keys[h] == value) {
+            return idx->positions[h];
+        }
+        h = (h + 1) & idx->mask;
+    }
+    return -1;
+}
+
+void freePosIndex(PosIndex* idx) {
+    free(idx->keys);
+    free(idx->positions);
+}
+
+// Releases every node of a rebuilt tree at once
+void freeArena(NodeArena* arena) {
+    free(arena->nodes);
+    arena->nodes = NULL;
+    arena->used = arena->capacity = 0;
+}
+
+// Shared O(n) builder. The root of each slice is its first preorder element
+// or its last postorder element; the inorder position splits the rest.
+static Node* buildFromSequences(const int* seq, const int* inorder, int n,
+                                int isPostorder, NodeArena* arena) {
+    arena->nodes = NULL;
+    arena->used = arena->capacity = 0;
+    if (n <= 0) {
+        return NULL;
+    }
+
+    PosIndex idx;
+    int built = buildPosIndex(&idx, inorder, n);
+    if (built != 1) {
+        printf(built == 0 ? "Duplicate values: the tree is not uniquely defined.\n"
+                          : "Too many values to index.\n");
+        freePosIndex(&idx);
+        return NULL;
+    }
+
+    arena->nodes = (Node*)malloc((size_t)n * sizeof(Node));
+    Frame* stack = (Frame*)malloc((size_t)(n + 1) * sizeof(Frame));
+    if (arena->nodes == NULL || stack == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    arena->capacity = n;
+
+    Node* root = NULL;
+    int top = 0;
+    stack[top++] = (Frame){&root, 0, 0, n};
+
+    while (top > 0) {
+        Frame f = stack[--top];
+        int value = isPostorder ? seq[f.seqStart + f.size - 1] : seq[f.seqStart];
+        int pos = lookupPos(&idx, value);
+        if (pos < f.inStart || pos >= f.inStart + f.size) {
+            printf("Sequences do not describe the same tree.\n");
+            free(stack);
+            freePosIndex(&idx);
+            freeArena(arena);
+            return NULL;
+        }
+
+        Node* node = &arena->nodes[arena->used++];
+        node->data = value;
+        node->left = node->right = NULL;
+        *f.slot = node;
+
+        int leftSize = pos - f.inStart;
+        int rightSize = f.size - leftSize - 1;
+        int leftSeq = isPostorder ? f.seqStart : f.seqStart + 1;
+        int rightSeq = leftSeq + leftSize;
+
+        if (rightSize > 0) {
+            stack[top++] = (Frame){&node->right, rightSeq, pos + 1, rightSize};
+        }
+        if (leftSize > 0) {
+            stack[top++] = (Frame){&node->left, leftSeq, f.inStart, leftSize};
+        }
+    }
+
+    free(stack);
+    freePosIndex(&idx);
+    return root;
+}
+
+// Rebuilds a tree from its preorder and inorder sequences
+Node* buildFromPreIn(const int* preorder, const int* inorder, int n, NodeArena* arena) {
+    return buildFromSequences(preorder, inorder, n, 0, arena);
+}
+
+// Rebuilds a tree from its postorder and inorder sequences
+Node* buildFromPostIn(const int* postorder, const int* inorder, int n, NodeArena* arena) {
+    return buildFromSequences(postorder, inorder, n, 1, arena);
+}
+
+// Preorder traversal: Root -> Left -> Right
+void printPreorder(Node* node) {
+    if (node == NULL) {
+        return;
+    }
+    printf("%d ", node->data);
+    printPreorder(node->left);
+    printPreorder(node->right);
+}
+
+// Postorder traversal: Left -> Right -> Root
+void printPostorder(Node* node) {
+    if (node == NULL) {
+        return;
+    }
+    printPostorder(node->left);
+    printPostorder(node->right);
+    printf("%d ", node->data);
+}
+
+// --- Benchmark helpers ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Old approach: insert preorder values one by one into a BST
+Node* insertNode(Node* node, int data) {
+    if (node == NULL) {
+        Node* newNode = (Node*)malloc(sizeof(Node));
+        newNode->data = data;
+        newNode->left = newNode->right = NULL;
+        return newNode;
+    }
+    if (data < node->data) {
+        node->left = insertNode(node->left, data);
+    } else {
+        node->right = insertNode(node->right, data);
+    }
+    return node;
+}
+
+void freeTree(Node* node) {
+    if (node != NULL) {
+        freeTree(node->left);
+        freeTree(node->right);
+        free(node);
+    }
+}
+
+// Writes the preorder sequence of the balanced BST over lo..hi
+void balancedPreorder(int lo, int hi, int* out, int* count) {
+    if (lo > hi) {
+        return;
+    }
+    int mid = lo + (hi - lo) / 2;
+    out[(*count)++] = mid;
+    balancedPreorder(lo, mid - 1, out, count);
+    balancedPreorder(mid + 1, hi, out, count);
+}
+
+void runBenchmark(int n) {
+    int* pre = (int*)malloc((size_t)n * sizeof(int));
+    int* in = (int*)malloc((size_t)n * sizeof(int));
+    int count = 0;
+    balancedPreorder(0, n - 1, pre, &count);
+    for (int i = 0; i < n; i++) {
+        in[i] = i;
+    }
+
+    double t = nowSeconds();
+    Node* root = NULL;
+    for (int i = 0; i < n; i++) {
+        root = insertNode(root, pre[i]);
+    }
+    printf("Re-insertion : %.3f s\n", nowSeconds() - t);
+    freeTree(root);
+
+    NodeArena arena;
+    t = nowSeconds();
+    root = buildFromPreIn(pre, in, n, &arena);
+    printf("Pre+In build : %.3f s\n", nowSeconds() - t);
+    freeArena(&arena);
+
+    free(pre);
+    free(in);
+}
+
+// Usage: Construct_Tree [bench <nodes>]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]));
+        return 0;
+    }
+
+    // Sequences printed by Traversal.c for the sample tree
+    int inorder[] = {20, 30, 40, 50, 60, 70, 80};
+    int preorder[] = {50, 30, 20, 40, 70, 60, 80};
+    int postorder[] = {20, 40, 30, 60, 80, 70, 50};
+    int n = sizeof(inorder) / sizeof(inorder[0]);
+
+    NodeArena arena;
+    Node* root = buildFromPreIn(preorder, inorder, n, &arena);
+    printf("Built from preorder + inorder, postorder: ");
+    printPostorder(root);
+    printf("\n");
+    freeArena(&arena);
+
+    root = buildFromPostIn(postorder, inorder, n, &arena);
+    printf("Built from postorder + inorder, preorder: ");
+    printPreorder(root);
+    printf("\n");
+    freeArena(&arena);
+
+    return 0;
+}
@@ -0,0 +1,414 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define DEQUE_CAPACITY 1024
+#define HISTOGRAM_BUCKETS 16
+
+// Node structure
+typedef struct Node {
+    int data;
+    struct Node *left;
+    struct Node *right;
+} Node;
+
+// User-supplied associative reduction over node values. Results are
+// combined left subtree, root, right subtree, so the operation does not
+// need to be commutative.
+typedef struct {
+    size_t accSize;
+    void (*init)(void* acc);
+    void (*visit)(void* acc, int value);
+    void (*combine)(void* acc, const void* other); // acc = acc (+) other
+} Reduction;
+
+// A forked subtree waiting to be aggregated
+typedef struct Task {
+    Node* node;
+    int depth;
+    const Reduction* op;
+    void* acc;
+    atomic_int done;
+} Task;
+
+// Per-worker deque: the owner pushes and pops at the bottom, thieves take from the top
+typedef struct {
+    pthread_mutex_t lock;
+    Task* items[DEQUE_CAPACITY];
+    int top;
+    int bottom;
+} Deque;
+
+typedef struct Pool Pool;
+
+typedef struct {
+    Pool* pool;
+    int id;
+    unsigned int seed;
+} Worker;
+
+// Work-stealing pool; worker 0 is the thread that calls parallelReduce
+struct Pool {
+    int numWorkers;
+    int forkDepth;
+    Deque* deques;
+    Worker* workers;
+    pthread_t* threads;
+    atomic_int stop;
+};
+
+// --- Deque operations ---
+
+void pushBottom(Deque* d, Task* t) {
+    pthread_mutex_lock(&d->lock);
+    if (d->bottom - d->top >= DEQUE_CAPACITY) {
+        printf("Task deque overflow.\n");
+        exit(1);
+    }
+    d->items[d->bottom++ % DEQUE_CAPACITY] = t;
+    pthread_mutex_unlock(&d->lock);
+}
+
+Task* popBottom(Deque* d) {
+    Task* t = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->bottom > d->top) {
+        t = d->items[--d->bottom % DEQUE_CAPACITY];
+    }
+    pthread_mutex_unlock(&d->lock);
+    return t;
+}
+
+Task* stealTop(Deque* d) {
+    Task* t = NULL;
+    pthread_mutex_lock(&d->lock);
+    if (d->bottom > d->top) {
+        t = d->items[d->top++ % DEQUE_CAPACITY];
+    }
+    pthread_mutex_unlock(&d->lock);
+    return t;
+}
+
+// Takes a task from a random other worker, if any has one
+Task* trySteal(Worker* w) {
+    Pool* p = w->pool;
+    if (p->numWorkers < 2) {
+        return NULL;
+    }
+    w->seed ^= w->seed << 13;
+    w->seed ^= w->seed >> 17;
+    w->seed ^= w->seed << 5;
+    int start = (int)(w->seed % (unsigned int)p->numWorkers);
+    for (int i = 0; i < p->numWorkers; i++) {
+        int victim = (start + i) % p->numWorkers;
+        if (victim != w->id) {
+            Task* t = stealTop(&p->deques[victim]);
+            if (t != NULL) {
+                return t;
+            }
+        }
+    }
+    return NULL;
+}
+
+// --- Aggregation ---
+
+// Sequential reduction used below the fork cutoff
+void aggregateSequential(Node* node, const Reduction* op, void* acc) {
+    while (node != NULL) {
+        aggregateSequential(node->left, op, acc);
+        op->visit(acc, node->data);
+        node = node->right;
+    }
+}
+
+void runTask(Worker* w, Task* t);
+
+// Waits for a forked task, running other work instead of blocking
+void joinTask(Worker* w, Task* t) {
+    while (!atomic_load_explicit(&t->done, memory_order_acquire)) {
+        Task* other = popBottom(&w->pool->deques[w->id]);
+        if (other == NULL) {
+            other = trySteal(w);
+        }
+        if (other != NULL) {
+            runTask(w, other);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+// Forks the right subtree while above the cutoff depth, then joins it
+void aggregate(Worker* w, Node* node, int depth, const Reduction* op, void* acc) {
+    if (node == NULL) {
+        return;
+    }
+    if (depth >= w->pool->forkDepth || node->right == NULL) {
+        aggregateSequential(node, op, acc);
+        return;
+    }
+
+    Task right;
+    right.node = node->right;
+    right.depth = depth + 1;
+    right.op = op;
+    right.acc = malloc(op->accSize);
+    if (right.acc == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    op->init(right.acc);
+    atomic_init(&right.done, 0);
+    pushBottom(&w->pool->deques[w->id], &right);
+
+    aggregate(w, node->left, depth + 1, op, acc);
+    op->visit(acc, node->data);
+
+    joinTask(w, &right);
+    op->combine(acc, right.acc);
+    free(right.acc);
+}
+
+void runTask(Worker* w, Task* t) {
+    aggregate(w, t->node, t->depth, t->op, t->acc);
+    atomic_store_explicit(&t->done, 1, memory_order_release);
+}
+
+// Helper threads steal until the pool is stopped
+void* workerLoop(void* arg) {
+    Worker* w = (Worker*)arg;
+    while (!atomic_load_explicit(&w->pool->stop, memory_order_acquire)) {
+        Task* t = trySteal(w);
+        if (t != NULL) {
+            runTask(w, t);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// --- Pool management ---
+
+Pool* createPool(int numWorkers) {
+    if (numWorkers < 1) {
+        numWorkers = 1;
+    }
+    Pool* p = (Pool*)malloc(sizeof(Pool));
+    p->numWorkers = numWorkers;
+    p->forkDepth = 0;
+    p->deques = (Deque*)calloc((size_t)numWorkers, sizeof(Deque));
+    p->workers = (Worker*)malloc((size_t)numWorkers * sizeof(Worker));
+    p->threads = (pthread_t*)malloc((size_t)numWorkers * sizeof(pthread_t));
+    if (p->deques == NULL || p->workers == NULL || p->threads == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    atomic_init(&p->stop, 0);
+    for (int i = 0; i < numWorkers; i++) {
+        pthread_mutex_init(&p->deques[i].lock, NULL);
+        p->workers[i].pool = p;
+        p->workers[i].id = i;
+        p->workers[i].seed = 2463534242u + (unsigned int)i * 7919u;
+    }
+    for (int i = 1; i < numWorkers; i++) {
+        pthread_create(&p->threads[i], NULL, workerLoop, &p->workers[i]);
+    }
+    return p;
+}
+
+void destroyPool(Pool* p) {
+    atomic_store_explicit(&p->stop, 1, memory_order_release);
+    for (int i = 1; i < p->numWorkers; i++) {
+        pthread_join(p->threads[i], NULL);
+    }
+    for (int i = 0; i < p->numWorkers; i++) {
+        pthread_mutex_destroy(&p->deques[i].lock);
+    }
+    free(p->deques);
+    free(p->workers);
+    free(p->threads);
+    free(p);
+}
+
+// Reduces the tree into result (op->accSize bytes). Subtrees are forked
+// while their estimated size, nodeCount / 2^depth, is above cutoff; the
+// estimate assumes a roughly balanced tree such as an AVL or random BST.
+void parallelReduce(Pool* p, Node* root, long nodeCount, long cutoff,
+                    const Reduction* op, void* result) {
+    int depth = 0;
+    if (cutoff < 1) {
+        cutoff = 1;
+    }
+    while ((nodeCount >> depth) > cutoff) {
+        depth++;
+    }
+    p->forkDepth = p->numWorkers > 1 ? depth : 0;
+    op->init(result);
+    aggregate(&p->workers[0], root, 0, op, result);
+}
+
+// --- Sample reductions ---
+
+typedef struct {
+    long long count;
+    long long sum;
+    int min;
+    int max;
+} Stats;
+
+void statsInit(void* acc) {
+    Stats* s = (Stats*)acc;
+    s->count = 0;
+    s->sum = 0;
+    s->min = INT_MAX;
+    s->max = INT_MIN;
+}
+
+void statsVisit(void* acc, int value) {
+    Stats* s = (Stats*)acc;
+    s->count++;
+    s->sum += value;
+    if (value < s->min) s->min = value;
+    if (value > s->max) s->max = value;
+}
+
+void statsCombine(void* acc, const void* other) {
+    Stats* s = (Stats*)acc;
+    const Stats* o = (const Stats*)other;
+    s->count += o->count;
+    s->sum += o->sum;
+    if (o->min < s->min) s->min = o->min;
+    if (o->max > s->max) s->max = o->max;
+}
+
+const Reduction statsReduction = {sizeof(Stats), statsInit, statsVisit, statsCombine};
+
+// Histogram of non-negative values by their top bits
+typedef struct {
+    long long buckets[HISTOGRAM_BUCKETS];
+} Histogram;
+
+void histogramInit(void* acc) {
+    memset(acc, 0, sizeof(Histogram));
+}
+
+void histogramVisit(void* acc, int value) {
+    Histogram* h = (Histogram*)acc;
+    unsigned int u = (unsigned int)value & 0x7FFFFFFFu;
+    h->buckets[u / (0x80000000u / HISTOGRAM_BUCKETS)]++;
+}
+
+void histogramCombine(void* acc, const void* other) {
+    Histogram* h = (Histogram*)acc;
+    const Histogram* o = (const Histogram*)other;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        h->buckets[i] += o->buckets[i];
+    }
+}
+
+const Reduction histogramReduction = {sizeof(Histogram), histogramInit, histogramVisit,
+                                      histogramCombine};
+
+// --- Tree building and benchmark ---
+
+Node* createNode(int data) {
+    Node* newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->left = newNode->right = NULL;
+    return newNode;
+}
+
+// Builds a balanced tree of count nodes with pseudo-random values
+Node* buildTree(long count, unsigned int* seed) {
+    if (count <= 0) {
+        return NULL;
+    }
+    long leftCount = (count - 1) / 2;
+    Node* node = createNode(0);
+    node->left = buildTree(leftCount, seed);
+    *seed = *seed * 1103515245u + 12345u;
+    node->data = (int)(*seed & 0x7FFFFFFFu);
+    node->right = buildTree(count - 1 - leftCount, seed);
+    return node;
+}
+
+void freeTree(Node* node) {
+    while (node != NULL) {
+        freeTree(node->left);
+        Node* right = node->right;
+        free(node);
+        node = right;
+    }
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void runBenchmark(long n, int maxThreads) {
+    unsigned int seed = 42;
+    Node* root = buildTree(n, &seed);
+    long cutoff = 1 << 14;
+    Stats s;
+    Histogram h;
+
+    double t = nowSeconds();
+    statsInit(&s);
+    aggregateSequential(root, &statsReduction, &s);
+    double base = nowSeconds() - t;
+    printf("Sequential      : %.3f s (sum %lld)\n", base, s.sum);
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        Pool* p = createPool(threads);
+        t = nowSeconds();
+        parallelReduce(p, root, n, cutoff, &statsReduction, &s);
+        double elapsed = nowSeconds() - t;
+        parallelReduce(p, root, n, cutoff, &histogramReduction, &h);
+        printf("%2d thread(s)    : %.3f s (sum %lld) speedup %.2fx\n",
+               threads, elapsed, s.sum, base / elapsed);
+        destroyPool(p);
+    }
+    freeTree(root);
+}
+
+// Usage: Parallel_Aggregate [bench <nodes> [max threads]]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atol(argv[2]), argc >= 4 ? atoi(argv[3]) : 8);
+        return 0;
+    }
+
+    unsigned int seed = 7;
+    long n = 100000;
+    Node* root = buildTree(n, &seed);
+
+    Pool* p = createPool(4);
+    Stats s;
+    parallelReduce(p, root, n, 1000, &statsReduction, &s);
+    printf("Count: %lld\nSum: %lld\nMin: %d\nMax: %d\n", s.count, s.sum, s.min, s.max);
+
+    Histogram h;
+    parallelReduce(p, root, n, 1000, &histogramReduction, &h);
+    printf("Histogram:");
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        printf(" %lld", h.buckets[i]);
+    }
+    printf("\n");
+
+    destroyPool(p);
+    freeTree(root);
+    return 0;
+}
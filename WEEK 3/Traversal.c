@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define OUT_BUF_SIZE (1 << 20)
 
 // Node structure
 typedef struct Node {
@@ -8,6 +12,27 @@ typedef struct Node {
     struct Node *right;
 } Node;
 
+// Output buffer that is flushed to the stream in large writes
+typedef struct {
+    FILE* stream;
+    char* data;
+    size_t len;
+    int binary; // 1: raw int32 little-endian, 0: decimal text
+} OutBuf;
+
+// "00" "01" ... "99", used to emit two digits per division
+static const char digitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 // Function to create a new node
 Node* createNode(int data) {
     Node* newNode = (Node*)malloc(sizeof(Node));
@@ -33,37 +58,210 @@ Node* insertNode(Node* node, int data) {
     return node;
 }
 
+// Initializes the output buffer for a stream
+void outInit(OutBuf* out, FILE* stream, int binary) {
+    out->stream = stream;
+    out->data = (char*)malloc(OUT_BUF_SIZE);
+    if (out->data == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    out->len = 0;
+    out->binary = binary;
+}
+
+// Writes the buffered bytes to the stream in one call
+void outFlush(OutBuf* out) {
+    if (out->len > 0 && fwrite(out->data, 1, out->len, out->stream) != out->len) {
+        perror("Write failed");
+        exit(1);
+    }
+    out->len = 0;
+}
+
+// Flushes remaining output and releases the buffer
+void outClose(OutBuf* out) {
+    outFlush(out);
+    fflush(out->stream);
+    free(out->data);
+    out->data = NULL;
+}
+
+// Appends a string (ignored in binary mode)
+void outWriteStr(OutBuf* out, const char* s) {
+    if (out->binary) {
+        return;
+    }
+    size_t n = strlen(s);
+    if (out->len + n > OUT_BUF_SIZE) {
+        outFlush(out);
+    }
+    memcpy(out->data + out->len, s, n);
+    out->len += n;
+}
+
+// Formats value right-aligned so that it ends just before 'end'; returns its start
+static char* formatInt(char* end, int value) {
+    unsigned int u = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    char* p = end;
+    while (u >= 100) {
+        unsigned int r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, &digitPairs[r * 2], 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, &digitPairs[u * 2], 2);
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+    return p;
+}
+
+// Appends one value: "<digits> " in text mode, 4 bytes in binary mode
+void outWriteInt(OutBuf* out, int value) {
+    if (out->len + 16 > OUT_BUF_SIZE) {
+        outFlush(out);
+    }
+    char* dst = out->data + out->len;
+    if (out->binary) {
+        unsigned int u = (unsigned int)value;
+        dst[0] = (char)(u & 0xFF);
+        dst[1] = (char)((u >> 8) & 0xFF);
+        dst[2] = (char)((u >> 16) & 0xFF);
+        dst[3] = (char)((u >> 24) & 0xFF);
+        out->len += 4;
+        return;
+    }
+    char tmp[16];
+    char* end = tmp + sizeof(tmp);
+    *--end = ' ';
+    char* start = formatInt(end, value);
+    size_t n = (size_t)(tmp + sizeof(tmp) - start);
+    memcpy(dst, start, n);
+    out->len += n;
+}
+
 // Inorder traversal: Left -> Root -> Right
-void printInorder(Node* node) {
+void printInorder(Node* node, OutBuf* out) {
     if (node == NULL) {
         return;
     }
-    printInorder(node->left);
-    printf("%d ", node->data);
-    printInorder(node->right);
+    printInorder(node->left, out);
+    outWriteInt(out, node->data);
+    printInorder(node->right, out);
 }
 
 // Preorder traversal: Root -> Left -> Right
-void printPreorder(Node* node) {
+void printPreorder(Node* node, OutBuf* out) {
     if (node == NULL) {
         return;
     }
-    printf("%d ", node->data);
-    printPreorder(node->left);
-    printPreorder(node->right);
+    outWriteInt(out, node->data);
+    printPreorder(node->left, out);
+    printPreorder(node->right, out);
 }
 
 // Postorder traversal: Left -> Right -> Root
-void printPostorder(Node* node) {
+void printPostorder(Node* node, OutBuf* out) {
     if (node == NULL) {
         return;
     }
-    printPostorder(node->left);
-    printPostorder(node->right);
-    printf("%d ", node->data);
+    printPostorder(node->left, out);
+    printPostorder(node->right, out);
+    outWriteInt(out, node->data);
+}
+
+// --- Benchmark helpers ---
+
+// Wall-clock time in seconds
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Builds a balanced BST holding the keys lo..hi
+Node* buildBalanced(int lo, int hi) {
+    if (lo > hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    Node* node = createNode(mid);
+    node->left = buildBalanced(lo, mid - 1);
+    node->right = buildBalanced(mid + 1, hi);
+    return node;
 }
 
-int main() {
+// Baseline: one printf call per node
+void printfInorder(Node* node, FILE* stream) {
+    if (node == NULL) {
+        return;
+    }
+    printfInorder(node->left, stream);
+    fprintf(stream, "%d ", node->data);
+    printfInorder(node->right, stream);
+}
+
+void freeTree(Node* node) {
+    if (node != NULL) {
+        freeTree(node->left);
+        freeTree(node->right);
+        free(node);
+    }
+}
+
+// Dumps the inorder traversal of n nodes three ways and reports throughput
+void runBenchmark(int n, const char* path) {
+    Node* root = buildBalanced(-(n / 2), n - n / 2 - 1);
+    double t, elapsed;
+    long size;
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        perror("Cannot open output file");
+        exit(1);
+    }
+    t = nowSeconds();
+    printfInorder(root, f);
+    fflush(f);
+    elapsed = nowSeconds() - t;
+    size = ftell(f);
+    fclose(f);
+    printf("printf text : %8.3f s  %8.1f MB/s\n", elapsed, size / elapsed / 1e6);
+
+    for (int binary = 0; binary <= 1; binary++) {
+        f = fopen(path, "wb");
+        if (f == NULL) {
+            perror("Cannot open output file");
+            exit(1);
+        }
+        OutBuf out;
+        outInit(&out, f, binary);
+        t = nowSeconds();
+        printInorder(root, &out);
+        outClose(&out);
+        elapsed = nowSeconds() - t;
+        size = ftell(f);
+        fclose(f);
+        printf("%s: %8.3f s  %8.1f MB/s\n", binary ? "buffer int32" : "buffer text ",
+               elapsed, size / elapsed / 1e6);
+    }
+
+    freeTree(root);
+}
+
+// Usage: Traversal [bench <nodes> [output file]]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), argc >= 4 ? argv[3] : "traversal_dump.bin");
+        return 0;
+    }
+
     Node* root = NULL;
     int values[] = {50, 30, 70, 20, 40, 60, 80};
     int n = sizeof(values) / sizeof(values[0]);
@@ -72,18 +270,23 @@ int main() {
         root = insertNode(root, values[i]);
     }
 
-    printf("Inorder traversal: ");
-    printInorder(root);
-    printf("\n");
+    OutBuf out;
+    outInit(&out, stdout, 0);
 
-    printf("Preorder traversal: ");
-    printPreorder(root);
-    printf("\n");
+    outWriteStr(&out, "Inorder traversal: ");
+    printInorder(root, &out);
+    outWriteStr(&out, "\n");
 
-    printf("Postorder traversal: ");
-    printPostorder(root);
-    printf("\n");
+    outWriteStr(&out, "Preorder traversal: ");
+    printPreorder(root, &out);
+    outWriteStr(&out, "\n");
 
-    // Note: To free memory, you'd add a separate function for that.
+    outWriteStr(&out, "Postorder traversal: ");
+    printPostorder(root, &out);
+    outWriteStr(&out, "\n");
+
+    outClose(&out);
+
+    freeTree(root);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,489 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// File layout (host byte order, written and read on little-endian machines):
+//   TreeHeader
+//   int32  values[nodeCount]           node values in level order, padded to 8 bytes
+//   uint64 bitmap[words]               bit s set when child slot s holds a node
+//   uint32 rank[words]                 set bits before each bitmap word, padded to 8 bytes
+// Slot 0 is the root; the children of the i-th node in level order are
+// slots 2i+1 and 2i+2, and a set slot s is node number rank1(s).
+#define TREE_MAGIC "BTLO"
+#define TREE_VERSION 1u
+
+// Node structure
+typedef struct Node {
+    int data;
+    struct Node *left;
+    struct Node *right;
+} Node;
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint64_t nodeCount;
+    uint64_t slotCount;
+    uint64_t payloadSize;
+    uint64_t checksum; // over everything after the header
+} TreeHeader;
+
+// Read-only tree used in place from the file image
+typedef struct {
+    void* base;
+    size_t length;
+    int mapped; // 1 when base came from mmap
+    uint64_t nodeCount;
+    const int32_t* values;
+    const uint64_t* bitmap;
+    const uint32_t* rank;
+} MappedTree;
+
+// --- Layout helpers ---
+
+static size_t align8(size_t n) {
+    return (n + 7) & ~(size_t)7;
+}
+
+static uint64_t wordCount(uint64_t slots) {
+    return (slots + 63) / 64;
+}
+
+static int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    int c = 0;
+    while (x) {
+        x &= x - 1;
+        c++;
+    }
+    return c;
+#endif
+}
+
+// Word-at-a-time FNV-1a style hash; size is a multiple of 8
+uint64_t checksum64(const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 1099511628211ull;
+    }
+    return h;
+}
+
+// --- Tree helpers ---
+
+Node* createNode(int data) {
+    Node* newNode = (Node*)malloc(sizeof(Node));
+    if (newNode == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    newNode->data = data;
+    newNode->left = newNode->right = NULL;
+    return newNode;
+}
+
+Node* insertNode(Node* node, int data) {
+    if (node == NULL) {
+        return createNode(data);
+    }
+    if (data < node->data) {
+        node->left = insertNode(node->left, data);
+    } else {
+        node->right = insertNode(node->right, data);
+    }
+    return node;
+}
+
+void freeTree(Node* node) {
+    if (node != NULL) {
+        freeTree(node->left);
+        freeTree(node->right);
+        free(node);
+    }
+}
+
+// Inorder traversal: Left -> Root -> Right
+void printInorder(Node* node) {
+    if (node == NULL) {
+        return;
+    }
+    printInorder(node->left);
+    printf("%d ", node->data);
+    printInorder(node->right);
+}
+
+// --- Saving ---
+
+// Writes the tree to path; returns 0 on success, -1 on failure
+int saveTree(Node* root, const char* path) {
+    // Level-order list of nodes
+    size_t count = 0, capacity = 1024;
+    Node** order = (Node**)malloc(capacity * sizeof(Node*));
+    if (order == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    if (root != NULL) {
+        order[count++] = root;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (count + 2 > capacity) {
+            capacity *= 2;
+            order = (Node**)realloc(order, capacity * sizeof(Node*));
+            if (order == NULL) {
+                perror("Memory allocation failed");
+                exit(1);
+            }
+        }
+        if (order[i]->left) order[count++] = order[i]->left;
+        if (order[i]->right) order[count++] = order[i]->right;
+    }
+
+    uint64_t slots = 2 * (uint64_t)count + 1;
+    uint64_t words = wordCount(slots);
+    size_t valuesSize = align8(count * sizeof(int32_t));
+    size_t bitmapSize = words * sizeof(uint64_t);
+    size_t rankSize = align8(words * sizeof(uint32_t));
+    size_t payloadSize = valuesSize + bitmapSize + rankSize;
+
+    unsigned char* payload = (unsigned char*)calloc(1, payloadSize ? payloadSize : 1);
+    if (payload == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    int32_t* values = (int32_t*)payload;
+    uint64_t* bitmap = (uint64_t*)(payload + valuesSize);
+    uint32_t* rank = (uint32_t*)(payload + valuesSize + bitmapSize);
+
+    if (count > 0) {
+        bitmap[0] |= 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        values[i] = order[i]->data;
+        if (order[i]->left) bitmap[(2 * i + 1) / 64] |= 1ull << ((2 * i + 1) % 64);
+        if (order[i]->right) bitmap[(2 * i + 2) / 64] |= 1ull << ((2 * i + 2) % 64);
+    }
+    uint32_t running = 0;
+    for (uint64_t w = 0; w < words; w++) {
+        rank[w] = running;
+        running += (uint32_t)popcount64(bitmap[w]);
+    }
+    free(order);
+
+    TreeHeader header;
+    memcpy(header.magic, TREE_MAGIC, 4);
+    header.version = TREE_VERSION;
+    header.nodeCount = count;
+    header.slotCount = slots;
+    header.payloadSize = payloadSize;
+    header.checksum = checksum64(payload, payloadSize);
+
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        perror("Cannot open file for writing");
+        free(payload);
+        return -1;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1
+             && fwrite(payload, 1, payloadSize, f) == payloadSize;
+    ok = (fclose(f) == 0) && ok;
+    free(payload);
+    if (!ok) {
+        printf("Failed to write %s.\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+// --- Loading in place ---
+
+// Maps the file (or reads it where mmap is unavailable) and validates the
+// header. The checksum pass touches every byte, so it is optional.
+int openMappedTree(MappedTree* t, const char* path, int verifyChecksum) {
+    memset(t, 0, sizeof(*t));
+#ifdef _WIN32
+    FILE* f = fopen(path, "rb");
+    if (f == NULL) {
+        perror("Cannot open file");
+        return -1;
+    }
+    fseek(f, 0, SEEK_END);
+    t->length = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    t->base = malloc(t->length ? t->length : 1);
+    if (t->base == NULL || fread(t->base, 1, t->length, f) != t->length) {
+        printf("Failed to read %s.\n", path);
+        fclose(f);
+        free(t->base);
+        return -1;
+    }
+    fclose(f);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("Cannot open file");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        perror("Cannot stat file");
+        close(fd);
+        return -1;
+    }
+    t->length = (size_t)st.st_size;
+    if (t->length < sizeof(TreeHeader)) {
+        printf("%s is too small to be a tree file.\n", path);
+        close(fd);
+        return -1;
+    }
+    t->base = mmap(NULL, t->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (t->base == MAP_FAILED) {
+        perror("mmap failed");
+        t->base = NULL;
+        return -1;
+    }
+    t->mapped = 1;
+#endif
+
+    const TreeHeader* h = (const TreeHeader*)t->base;
+    const char* error = NULL;
+    if (t->length < sizeof(TreeHeader) || memcmp(h->magic, TREE_MAGIC, 4) != 0) {
+        error = "bad magic";
+    } else if (h->version != TREE_VERSION) {
+        error = "unsupported version or byte order";
+    } else if (h->slotCount != 2 * h->nodeCount + 1
+               || h->payloadSize != t->length - sizeof(TreeHeader)
+               || h->payloadSize != align8(h->nodeCount * sizeof(int32_t))
+                                    + wordCount(h->slotCount) * sizeof(uint64_t)
+                                    + align8(wordCount(h->slotCount) * sizeof(uint32_t))) {
+        error = "inconsistent sizes";
+    } else if (verifyChecksum
+               && checksum64((const unsigned char*)t->base + sizeof(TreeHeader),
+                             h->payloadSize) != h->checksum) {
+        error = "checksum mismatch";
+    } else {
+        // O(1) checks that the bitmap agrees with nodeCount: the last rank
+        // entry plus the last word's bits count every node, no bit is set
+        // past slotCount, and slot 0 (the root) is set unless the tree is empty
+        const unsigned char* payload = (const unsigned char*)t->base + sizeof(TreeHeader);
+        uint64_t words = wordCount(h->slotCount);
+        const uint64_t* bitmap = (const uint64_t*)(payload + align8(h->nodeCount * sizeof(int32_t)));
+        const uint32_t* rank = (const uint32_t*)(bitmap + words);
+        uint64_t tailBits = h->slotCount % 64;
+        uint64_t last = bitmap[words - 1];
+        if ((uint64_t)rank[words - 1] + popcount64(last) != h->nodeCount
+            || (tailBits != 0 && (last >> tailBits) != 0)
+            || (bitmap[0] & 1) != (h->nodeCount > 0)) {
+            error = "presence bitmap does not match node count";
+        }
+    }
+    if (error != NULL) {
+        printf("Invalid tree file %s: %s.\n", path, error);
+        if (t->mapped) {
+#ifndef _WIN32
+            munmap(t->base, t->length);
+#endif
+        } else {
+            free(t->base);
+        }
+        t->base = NULL;
+        return -1;
+    }
+
+    const unsigned char* payload = (const unsigned char*)t->base + sizeof(TreeHeader);
+    t->nodeCount = h->nodeCount;
+    t->values = (const int32_t*)payload;
+    t->bitmap = (const uint64_t*)(payload + align8(h->nodeCount * sizeof(int32_t)));
+    t->rank = (const uint32_t*)((const unsigned char*)t->bitmap
+                                + wordCount(h->slotCount) * sizeof(uint64_t));
+    return 0;
+}
+
+void closeMappedTree(MappedTree* t) {
+    if (t->base == NULL) {
+        return;
+    }
+#ifndef _WIN32
+    if (t->mapped) {
+        munmap(t->base, t->length);
+    } else
+#endif
+    {
+        free(t->base);
+    }
+    t->base = NULL;
+}
+
+// Node index stored in slot s, or -1 when the slot is empty. Inner rank
+// entries are only covered by the checksum, so the result is range-checked.
+static int64_t slotToNode(const MappedTree* t, uint64_t s) {
+    uint64_t word = t->bitmap[s / 64];
+    uint64_t bit = 1ull << (s % 64);
+    if (!(word & bit)) {
+        return -1;
+    }
+    uint64_t node = t->rank[s / 64] + popcount64(word & (bit - 1));
+    return node < t->nodeCount ? (int64_t)node : -1;
+}
+
+// Index-based navigation; -1 means no node
+int64_t mappedRoot(const MappedTree* t) {
+    return t->nodeCount ? 0 : -1;
+}
+
+int64_t mappedLeft(const MappedTree* t, int64_t i) {
+    return slotToNode(t, 2 * (uint64_t)i + 1);
+}
+
+int64_t mappedRight(const MappedTree* t, int64_t i) {
+    return slotToNode(t, 2 * (uint64_t)i + 2);
+}
+
+int mappedValue(const MappedTree* t, int64_t i) {
+    return t->values[i];
+}
+
+void printMappedInorder(const MappedTree* t, int64_t i) {
+    if (i < 0) {
+        return;
+    }
+    printMappedInorder(t, mappedLeft(t, i));
+    printf("%d ", mappedValue(t, i));
+    printMappedInorder(t, mappedRight(t, i));
+}
+
+// --- Loading into pointer nodes ---
+
+// Rebuilds pointer nodes in one arena; free the arena (which is the root) to release the tree
+Node* buildArenaTree(const MappedTree* t) {
+    if (t->nodeCount == 0) {
+        return NULL;
+    }
+    Node* arena = (Node*)malloc(t->nodeCount * sizeof(Node));
+    if (arena == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    // Children are numbered in the same order as their slots, so a running counter suffices
+    uint64_t next = 1;
+    for (uint64_t i = 0; i < t->nodeCount; i++) {
+        uint64_t l = 2 * i + 1, r = 2 * i + 2;
+        arena[i].data = t->values[i];
+        int hasLeft = (t->bitmap[l / 64] >> (l % 64)) & 1;
+        int hasRight = (t->bitmap[r / 64] >> (r % 64)) & 1;
+        // Inner bitmap words are only covered by the checksum
+        if (next + hasLeft + hasRight > t->nodeCount) {
+            printf("Corrupt tree file: more child slots than nodes.\n");
+            free(arena);
+            return NULL;
+        }
+        arena[i].left = hasLeft ? &arena[next++] : NULL;
+        arena[i].right = hasRight ? &arena[next++] : NULL;
+    }
+    return arena;
+}
+
+// --- Benchmark ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+Node* buildBalanced(int lo, int hi) {
+    if (lo > hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    Node* node = createNode(mid);
+    node->left = buildBalanced(lo, mid - 1);
+    node->right = buildBalanced(mid + 1, hi);
+    return node;
+}
+
+void runBenchmark(int n, const char* path) {
+    Node* root = buildBalanced(0, n - 1);
+    double t = nowSeconds();
+    if (saveTree(root, path) != 0) {
+        exit(1);
+    }
+    printf("Save              : %.3f s\n", nowSeconds() - t);
+    freeTree(root);
+
+    MappedTree mt;
+    t = nowSeconds();
+    if (openMappedTree(&mt, path, 0) != 0) {
+        exit(1);
+    }
+    printf("mmap (no verify)  : %.3f ms\n", (nowSeconds() - t) * 1e3);
+    closeMappedTree(&mt);
+
+    t = nowSeconds();
+    openMappedTree(&mt, path, 1);
+    printf("mmap + checksum   : %.3f ms\n", (nowSeconds() - t) * 1e3);
+
+    t = nowSeconds();
+    Node* arena = buildArenaTree(&mt);
+    printf("Arena rebuild     : %.3f ms\n", (nowSeconds() - t) * 1e3);
+    free(arena);
+    closeMappedTree(&mt);
+}
+
+// Usage: Tree_Serialize [bench <nodes> [file]]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), argc >= 4 ? argv[3] : "tree_bench.btlo");
+        return 0;
+    }
+
+    Node* root = NULL;
+    int values[] = {50, 30, 70, 20, 40, 60, 80, 65};
+    int n = sizeof(values) / sizeof(values[0]);
+    for (int i = 0; i < n; i++) {
+        root = insertNode(root, values[i]);
+    }
+
+    printf("Original inorder: ");
+    printInorder(root);
+    printf("\n");
+
+    if (saveTree(root, "tree.btlo") != 0) {
+        return 1;
+    }
+    freeTree(root);
+
+    MappedTree mt;
+    if (openMappedTree(&mt, "tree.btlo", 1) != 0) {
+        return 1;
+    }
+    printf("Mapped inorder:   ");
+    printMappedInorder(&mt, mappedRoot(&mt));
+    printf("\n");
+
+    Node* arena = buildArenaTree(&mt);
+    printf("Arena inorder:    ");
+    printInorder(arena);
+    printf("\n");
+
+    free(arena);
+    closeMappedTree(&mt);
+    return 0;
+}
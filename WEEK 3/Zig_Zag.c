@@ -2,91 +2,168 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
-// Node and Queue structures
+// Node and Deque structures
 typedef struct TreeNode {
     int val;
     struct TreeNode *left;
     struct TreeNode *right;
 } TreeNode;
 
-typedef struct Queue {
-    TreeNode* items[100];
-    int front;
-    int rear;
-} Queue;
+// Growable circular deque of node pointers
+typedef struct Deque {
+    TreeNode** items;
+    int head;     // index of the front element
+    int count;
+    int capacity; // always a power of two
+} Deque;
+
+// Zigzag output: level i occupies values[levelOffsets[i] .. levelOffsets[i + 1])
+typedef struct ZigzagResult {
+    int* values;
+    int* levelOffsets;
+    int levels;
+    int count;
+} ZigzagResult;
+
+// Deque operations
+void initialize(Deque* d) {
+    d->capacity = 16;
+    d->items = (TreeNode**)malloc(d->capacity * sizeof(TreeNode*));
+    if (d->items == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    d->head = 0;
+    d->count = 0;
+}
 
-// Queue operations
-void initialize(Queue *q) {
-    q->front = -1;
-    q->rear = -1;
+void destroy(Deque* d) {
+    free(d->items);
+    d->items = NULL;
 }
 
-bool isEmpty(Queue* q) {
-    return q->front == -1 || q->front > q->rear;
+bool isEmpty(Deque* d) {
+    return d->count == 0;
 }
 
-void enqueue(Queue* q, TreeNode* node) {
-    if (q->front == -1) {
-        q->front = 0;
+// Doubles the capacity and unwraps the elements to start at index 0
+void grow(Deque* d) {
+    int newCapacity = d->capacity * 2;
+    TreeNode** items = (TreeNode**)malloc(newCapacity * sizeof(TreeNode*));
+    if (items == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
     }
-    q->items[++q->rear] = node;
+    for (int i = 0; i < d->count; i++) {
+        items[i] = d->items[(d->head + i) & (d->capacity - 1)];
+    }
+    free(d->items);
+    d->items = items;
+    d->head = 0;
+    d->capacity = newCapacity;
 }
 
-TreeNode* dequeue(Queue* q) {
-    if (isEmpty(q)) {
-        return NULL;
+void pushBack(Deque* d, TreeNode* node) {
+    if (d->count == d->capacity) {
+        grow(d);
     }
-    return q->items[q->front++];
+    d->items[(d->head + d->count) & (d->capacity - 1)] = node;
+    d->count++;
 }
 
-// Reverses an array
-void reverse(int* arr, int size) {
-    int start = 0, end = size - 1;
-    while (start < end) {
-        int temp = arr[start];
-        arr[start] = arr[end];
-        arr[end] = temp;
-        start++;
-        end--;
+void pushFront(Deque* d, TreeNode* node) {
+    if (d->count == d->capacity) {
+        grow(d);
     }
+    d->head = (d->head - 1) & (d->capacity - 1);
+    d->items[d->head] = node;
+    d->count++;
+}
+
+TreeNode* popFront(Deque* d) {
+    TreeNode* node = d->items[d->head];
+    d->head = (d->head + 1) & (d->capacity - 1);
+    d->count--;
+    return node;
+}
+
+TreeNode* popBack(Deque* d) {
+    d->count--;
+    return d->items[(d->head + d->count) & (d->capacity - 1)];
+}
+
+// Appends to a growable int array
+void appendInt(int** arr, int* size, int* capacity, int value) {
+    if (*size == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 16;
+        *arr = (int*)realloc(*arr, *capacity * sizeof(int));
+        if (*arr == NULL) {
+            perror("Memory allocation failed");
+            exit(1);
+        }
+    }
+    (*arr)[(*size)++] = value;
 }
 
 // Zigzag Traversal
-void zigzagTraversal(TreeNode* root) {
+// The deque always holds one level in left-to-right order. Left-to-right
+// levels are consumed from the front and feed the next level at the back;
+// right-to-left levels are consumed from the back and feed the front in
+// mirrored child order. Values therefore come out already zigzagged.
+ZigzagResult zigzagTraversal(TreeNode* root) {
+    ZigzagResult res = {NULL, NULL, 0, 0};
+    int valuesCap = 0, offsetsCap = 0, offsetsSize = 0;
+
+    appendInt(&res.levelOffsets, &offsetsSize, &offsetsCap, 0);
     if (root == NULL) {
-        return;
+        return res;
     }
 
-    Queue q;
-    initialize(&q);
-    enqueue(&q, root);
+    Deque d;
+    initialize(&d);
+    pushBack(&d, root);
     bool leftToRight = true;
 
-    printf("[\n");
-    while (!isEmpty(&q)) {
-        int levelSize = q.rear - q.front + 1;
-        int levelVals[levelSize];
-
+    while (!isEmpty(&d)) {
+        int levelSize = d.count;
         for (int i = 0; i < levelSize; i++) {
-            TreeNode* node = dequeue(&q);
-            levelVals[i] = node->val;
-
-            if (node->left) enqueue(&q, node->left);
-            if (node->right) enqueue(&q, node->right);
+            TreeNode* node;
+            if (leftToRight) {
+                node = popFront(&d);
+                if (node->left) pushBack(&d, node->left);
+                if (node->right) pushBack(&d, node->right);
+            } else {
+                node = popBack(&d);
+                if (node->right) pushFront(&d, node->right);
+                if (node->left) pushFront(&d, node->left);
+            }
+            appendInt(&res.values, &res.count, &valuesCap, node->val);
         }
+        appendInt(&res.levelOffsets, &offsetsSize, &offsetsCap, res.count);
+        res.levels++;
+        leftToRight = !leftToRight;
+    }
 
-        if (!leftToRight) {
-            reverse(levelVals, levelSize);
-        }
+    destroy(&d);
+    return res;
+}
+
+void freeResult(ZigzagResult* res) {
+    free(res->values);
+    free(res->levelOffsets);
+    res->values = res->levelOffsets = NULL;
+}
 
+// Prints the result one level per line
+void printResult(ZigzagResult* res) {
+    printf("[\n");
+    for (int level = 0; level < res->levels; level++) {
         printf("  [");
-        for (int i = 0; i < levelSize; i++) {
-            printf("%d", levelVals[i]);
-            if (i < levelSize - 1) printf(", ");
+        for (int i = res->levelOffsets[level]; i < res->levelOffsets[level + 1]; i++) {
+            printf("%d", res->values[i]);
+            if (i < res->levelOffsets[level + 1] - 1) printf(", ");
         }
         printf("]\n");
-
-        leftToRight = !leftToRight;
     }
     printf("]\n");
 }
@@ -107,7 +184,9 @@ int main() {
     root->right->left->left = root->right->left->right = NULL;
     root->right->right->left = root->right->right->right = NULL;
 
-    zigzagTraversal(root);
+    ZigzagResult res = zigzagTraversal(root);
+    printResult(&res);
+    freeResult(&res);
 
     // Free allocated memory
     free(root->right->right);
@@ -117,4 +196,4 @@ int main() {
     free(root);
 
     return 0;
-}
\ No newline at end of file
+}
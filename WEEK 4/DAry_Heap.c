@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "Heap.h"
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#define CACHE_LINE 64
+#define PADDING INT_MAX // fills unused child slots so every group can be read whole
+
+// d-ary min-heap of ints (d = 4 or 8). The array is shifted by d - 1
+// slots, which puts the children of node i (logical indices d*i+1 ..
+// d*i+d) at physical offset d*(i+1): each group starts on a multiple of
+// 4*d bytes and so never straddles a cache line. Slots past the end hold
+// PADDING, so the minimum child is found with one full-width compare.
+typedef struct {
+    int* base;     // 64-byte aligned allocation
+    int* items;    // base + d - 1, indexed logically
+    int size;
+    int capacity;  // logical slots available, including padding
+    int d;
+} DAryHeap;
+
+#define LESS(a, b) ((a) < (b))
+DEFINE_HEAP(BinaryHeap, int, LESS)
+
+void daryInit(DAryHeap* h, int d) {
+    h->base = NULL;
+    h->items = NULL;
+    h->size = 0;
+    h->capacity = 0;
+    h->d = d;
+}
+
+void daryFree(DAryHeap* h) {
+    free(h->base);
+    daryInit(h, h->d);
+}
+
+// Grows so that the children group of every node can be read in full
+static void daryReserve(DAryHeap* h, int needed) {
+    int required = needed + h->d + 1;
+    if (required <= h->capacity) {
+        return;
+    }
+    int capacity = h->capacity > 0 ? h->capacity : 64;
+    while (capacity < required) {
+        capacity *= 2;
+    }
+    size_t bytes = ((size_t)(capacity + h->d) * sizeof(int) + CACHE_LINE - 1)
+                   / CACHE_LINE * CACHE_LINE;
+    int* base = (int*)aligned_alloc(CACHE_LINE, bytes);
+    if (base == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    int* items = base + h->d - 1;
+    if (h->size > 0) {
+        memcpy(items, h->items, (size_t)h->size * sizeof(int));
+    }
+    for (int i = h->size; i < capacity; i++) {
+        items[i] = PADDING;
+    }
+    free(h->base);
+    h->base = base;
+    h->items = items;
+    h->capacity = capacity;
+}
+
+// Index (0..3) of the smallest of four aligned ints
+static inline int minIndex4(const int* p) {
+#if defined(__SSE4_1__)
+    __m128i v = _mm_load_si128((const __m128i*)p);
+    __m128i m = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, m)));
+    return __builtin_ctz(mask);
+#else
+    int best = 0;
+    for (int i = 1; i < 4; i++) {
+        if (p[i] < p[best]) best = i;
+    }
+    return best;
+#endif
+}
+
+// Index (0..7) of the smallest of eight aligned ints
+static inline int minIndex8(const int* p) {
+#if defined(__AVX2__)
+    __m256i v = _mm256_load_si256((const __m256i*)p);
+    __m256i m = _mm256_min_epi32(v, _mm256_permute2x128_si256(v, v, 1));
+    m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm256_min_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, m)));
+    return __builtin_ctz(mask);
+#else
+    int a = minIndex4(p);
+    int b = 4 + minIndex4(p + 4);
+    return p[b] < p[a] ? b : a;
+#endif
+}
+
+void daryPush(DAryHeap* h, int value) {
+    daryReserve(h, h->size + 1);
+    int index = h->size++;
+    while (index > 0) {
+        int parent = (index - 1) / h->d;
+        if (h->items[parent] <= value) break;
+        h->items[index] = h->items[parent];
+        index = parent;
+    }
+    h->items[index] = value;
+}
+
+// Removes and returns the minimum; the heap must not be empty
+int daryPop(DAryHeap* h) {
+    int top = h->items[0];
+    int value = h->items[--h->size];
+    h->items[h->size] = PADDING;
+    if (h->size == 0) {
+        return top;
+    }
+    int index = 0;
+    while (1) {
+        int first = h->d * index + 1;
+        if (first >= h->size) break;
+        int child = first + (h->d == 4 ? minIndex4(&h->items[first]) : minIndex8(&h->items[first]));
+        if (h->items[child] >= value) break;
+        h->items[index] = h->items[child];
+        index = child;
+    }
+    h->items[index] = value;
+    return top;
+}
+
+// --- Benchmark ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Pushes n random values then pops them all; returns Mops/s and checks order
+double benchDAry(int d, const int* values, int n) {
+    DAryHeap h;
+    daryInit(&h, d);
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) daryPush(&h, values[i]);
+    int prev = INT_MIN;
+    for (int i = 0; i < n; i++) {
+        int v = daryPop(&h);
+        if (v < prev) {
+            printf("%d-ary heap order violated!\n", d);
+            exit(1);
+        }
+        prev = v;
+    }
+    double elapsed = nowSeconds() - t;
+    daryFree(&h);
+    return 2.0 * n / elapsed / 1e6;
+}
+
+double benchBinary(const int* values, int n) {
+    BinaryHeap h;
+    BinaryHeap_init(&h);
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) BinaryHeap_push(&h, values[i]);
+    for (int i = 0; i < n; i++) BinaryHeap_pop(&h);
+    double elapsed = nowSeconds() - t;
+    BinaryHeap_free(&h);
+    return 2.0 * n / elapsed / 1e6;
+}
+
+// Push/pop throughput at sizes 1K, 10K, ... up to maxSize
+void runBenchmark(long maxSize) {
+#if defined(__AVX2__)
+    printf("Child selection: AVX2 (8-ary), SSE4.1 (4-ary)\n");
+#elif defined(__SSE4_1__)
+    printf("Child selection: SSE4.1\n");
+#else
+    printf("Child selection: scalar (build with -march=native for SIMD)\n");
+#endif
+    printf("%12s %12s %12s %12s   (Mops/s, push + pop)\n", "size", "binary", "4-ary", "8-ary");
+    for (long n = 1000; n <= maxSize; n *= 10) {
+        int* values = (int*)malloc((size_t)n * sizeof(int));
+        if (values == NULL) {
+            perror("Memory allocation failed");
+            exit(1);
+        }
+        unsigned int seed = 7;
+        for (long i = 0; i < n; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            values[i] = (int)(seed >> 1);
+        }
+        // Small sizes are repeated so each row runs long enough to time
+        int reps = (int)(10000000 / n) + 1;
+        double b = 0, q = 0, o = 0;
+        for (int r = 0; r < reps; r++) {
+            b += benchBinary(values, (int)n);
+            q += benchDAry(4, values, (int)n);
+            o += benchDAry(8, values, (int)n);
+        }
+        printf("%12ld %12.1f %12.1f %12.1f\n", n, b / reps, q / reps, o / reps);
+        free(values);
+    }
+}
+
+// Usage: DAry_Heap [bench [max size]]   (bench sizes 1K, 10K, ... up to max size, default 10M)
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(argc >= 3 ? atol(argv[2]) : 10000000);
+        return 0;
+    }
+
+    DAryHeap h;
+    daryInit(&h, 4);
+    int sample[] = {10, 5, 15, 3, 8, 1, 20};
+    for (int i = 0; i < 7; i++) daryPush(&h, sample[i]);
+    printf("4-ary heap pops: ");
+    while (h.size > 0) printf("%d ", daryPop(&h));
+    printf("\n");
+    daryFree(&h);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Generic binary heap generated per element type and ordering.
+//
+//   #define GREATER(a, b) ((a) > (b))
+//   DEFINE_HEAP(MaxHeap, int, GREATER)
+//
+// defines the type MaxHeap and functions MaxHeap_init, MaxHeap_push,
+// MaxHeap_pop, MaxHeap_pushPop, MaxHeap_replaceTop, MaxHeap_popMany,
+// MaxHeap_sortInPlace, MaxHeap_build, ... BEFORE(a, b) must be true when a belongs
+// above b (a > b gives a max-heap, a < b a min-heap). Storage grows by
+// doubling. Sifting moves a hole instead of swapping, so each level costs
+// one copy rather than three.
+
+// Ensures *items can hold needed elements; shared by every heap layout
+static inline void heapReserve(void** items, int* capacity, int needed, size_t elemSize) {
+    if (needed <= *capacity) {
+        return;
+    }
+    int newCapacity = *capacity > 0 ? *capacity : 16;
+    while (newCapacity < needed) {
+        newCapacity *= 2;
+    }
+    void* grown = realloc(*items, (size_t)newCapacity * elemSize);
+    if (grown == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    *items = grown;
+    *capacity = newCapacity;
+}
+
+#define DEFINE_HEAP(Name, T, BEFORE)                                                  \
+typedef struct {                                                                      \
+    T* items;                                                                         \
+    int size;                                                                         \
+    int capacity;                                                                     \
+} Name;                                                                               \
+                                                                                      \
+static inline void Name##_init(Name* h) {                                             \
+    h->items = NULL;                                                                  \
+    h->size = 0;                                                                      \
+    h->capacity = 0;                                                                  \
+}                                                                                     \
+                                                                                      \
+static inline void Name##_free(Name* h) {                                             \
+    free(h->items);                                                                   \
+    Name##_init(h);                                                                   \
+}                                                                                     \
+                                                                                      \
+static inline void Name##_reserve(Name* h, int capacity) {                            \
+    heapReserve((void**)&h->items, &h->capacity, capacity, sizeof(T));                \
+}                                                                                     \
+                                                                                      \
+static inline int Name##_isEmpty(const Name* h) {                                     \
+    return h->size == 0;                                                              \
+}                                                                                     \
+                                                                                      \
+/* Moves items[index] up until its parent belongs above it */                         \
+static inline void Name##_siftUp(Name* h, int index) {                                \
+    T value = h->items[index];                                                        \
+    while (index > 0 && BEFORE(value, h->items[(index - 1) / 2])) {                   \
+        h->items[index] = h->items[(index - 1) / 2];                                  \
+        index = (index - 1) / 2;                                                      \
+    }                                                                                 \
+    h->items[index] = value;                                                          \
+}                                                                                     \
+                                                                                      \
+/* Moves items[index] down until no child belongs above it */                         \
+static inline void Name##_siftDown(Name* h, int index) {                              \
+    T value = h->items[index];                                                        \
+    int half = h->size / 2;                                                           \
+    while (index < half) {                                                            \
+        int child = 2 * index + 1;                                                    \
+        if (child + 1 < h->size && BEFORE(h->items[child + 1], h->items[child])) {    \
+            child++;                                                                  \
+        }                                                                             \
+        if (!BEFORE(h->items[child], value)) {                                        \
+            break;                                                                    \
+        }                                                                             \
+        h->items[index] = h->items[child];                                            \
+        index = child;                                                                \
+    }                                                                                 \
+    h->items[index] = value;                                                          \
+}                                                                                     \
+                                                                                      \
+static inline void Name##_push(Name* h, T value) {                                    \
+    Name##_reserve(h, h->size + 1);                                                   \
+    h->items[h->size] = value;                                                        \
+    Name##_siftUp(h, h->size);                                                        \
+    h->size++;                                                                        \
+}                                                                                     \
+                                                                                      \
+/* The heap must not be empty */                                                      \
+static inline T Name##_top(const Name* h) {                                           \
+    return h->items[0];                                                               \
+}                                                                                     \
+                                                                                      \
+/* Removes and returns the top; the heap must not be empty */                         \
+static inline T Name##_pop(Name* h) {                                                 \
+    T top = h->items[0];                                                              \
+    h->size--;                                                                        \
+    if (h->size > 0) {                                                                \
+        h->items[0] = h->items[h->size];                                              \
+        Name##_siftDown(h, 0);                                                        \
+    }                                                                                 \
+    return top;                                                                       \
+}                                                                                     \
+                                                                                      \
+/* Pops the top and inserts value with one sift-down; the heap must not be empty */   \
+static inline T Name##_replaceTop(Name* h, T value) {                                 \
+    T top = h->items[0];                                                              \
+    h->items[0] = value;                                                              \
+    Name##_siftDown(h, 0);                                                            \
+    return top;                                                                       \
+}                                                                                     \
+                                                                                      \
+/* Inserts value then pops the top; value returns at once if it would be on top */    \
+static inline T Name##_pushPop(Name* h, T value) {                                    \
+    if (h->size == 0 || !BEFORE(h->items[0], value)) {                                \
+        return value;                                                                 \
+    }                                                                                 \
+    return Name##_replaceTop(h, value);                                               \
+}                                                                                     \
+                                                                                      \
+/* Pops up to k items into out in pop order; returns how many */                      \
+static inline int Name##_popMany(Name* h, int k, T* out) {                            \
+    int count = k < h->size ? k : h->size;                                            \
+    for (int i = 0; i < count; i++) {                                                 \
+        out[i] = Name##_pop(h);                                                       \
+    }                                                                                 \
+    return count;                                                                     \
+}                                                                                     \
+                                                                                      \
+/* Heapsort in place: items[0..n) ends in reverse pop order (ascending for a */       \
+/* max-heap) and the heap is left empty. Returns n. */                                \
+static inline int Name##_sortInPlace(Name* h) {                                       \
+    int n = h->size;                                                                  \
+    while (h->size > 1) {                                                             \
+        T top = h->items[0];                                                          \
+        h->size--;                                                                    \
+        h->items[0] = h->items[h->size];                                              \
+        Name##_siftDown(h, 0);                                                        \
+        h->items[h->size] = top;                                                      \
+    }                                                                                 \
+    h->size = 0;                                                                      \
+    return n;                                                                         \
+}                                                                                     \
+                                                                                      \
+/* Replaces the contents with values in O(n): Floyd's bottom-up build */              \
+static inline void Name##_build(Name* h, const T* values, int n) {                    \
+    Name##_reserve(h, n);                                                             \
+    for (int i = 0; i < n; i++) {                                                     \
+        h->items[i] = values[i];                                                      \
+    }                                                                                 \
+    h->size = n;                                                                      \
+    for (int i = n / 2 - 1; i >= 0; i--) {                                            \
+        Name##_siftDown(h, i);                                                        \
+    }                                                                                 \
+}
+
+#endif
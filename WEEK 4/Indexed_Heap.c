@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Heap.h"
+
+// Indexed min-heap. insert returns a handle that stays valid until the
+// item is popped or removed; pos[] maps each handle to its heap slot so
+// decreaseKey, increaseKey and removeHandle find the item in O(1) and
+// restore order in O(log n). Handle indices of removed items are reused,
+// with a bumped generation so old handles are rejected.
+typedef struct {
+    int* heap;       // handle indices in heap order
+    int size;
+    int heapCapacity;
+    int* keys;       // keys[index]
+    int* pos;        // pos[index]: slot in heap, or -1 when not queued
+    unsigned int* generation; // generation[index]: bumped on release
+    int* freeList;   // released indices
+    int freeCount;
+    int handleCount; // indices ever allocated
+    int keysCapacity;
+    int posCapacity;
+    int generationCapacity;
+    int freeCapacity;
+} IndexedHeap;
+
+// An item's index plus the generation it was inserted in
+typedef struct {
+    int index;
+    unsigned int generation;
+} IndexedHandle;
+
+#define LESS(a, b) ((a) < (b))
+DEFINE_HEAP(MinHeap, int, LESS)
+
+void indexedInit(IndexedHeap* h) {
+    memset(h, 0, sizeof(*h));
+}
+
+void indexedFree(IndexedHeap* h) {
+    free(h->heap);
+    free(h->keys);
+    free(h->pos);
+    free(h->generation);
+    free(h->freeList);
+    indexedInit(h);
+}
+
+int indexedContains(const IndexedHeap* h, IndexedHandle handle) {
+    int i = handle.index;
+    return i >= 0 && i < h->handleCount && h->pos[i] >= 0
+        && h->generation[i] == handle.generation;
+}
+
+// Moves the handle at slot index up; the hole carries the handle along
+static void indexedSiftUp(IndexedHeap* h, int index) {
+    int handle = h->heap[index];
+    int key = h->keys[handle];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        int parentHandle = h->heap[parent];
+        if (h->keys[parentHandle] <= key) break;
+        h->heap[index] = parentHandle;
+        h->pos[parentHandle] = index;
+        index = parent;
+    }
+    h->heap[index] = handle;
+    h->pos[handle] = index;
+}
+
+static void indexedSiftDown(IndexedHeap* h, int index) {
+    int handle = h->heap[index];
+    int key = h->keys[handle];
+    int half = h->size / 2;
+    while (index < half) {
+        int child = 2 * index + 1;
+        if (child + 1 < h->size && h->keys[h->heap[child + 1]] < h->keys[h->heap[child]]) {
+            child++;
+        }
+        int childHandle = h->heap[child];
+        if (h->keys[childHandle] >= key) break;
+        h->heap[index] = childHandle;
+        h->pos[childHandle] = index;
+        index = child;
+    }
+    h->heap[index] = handle;
+    h->pos[handle] = index;
+}
+
+// Inserts key and returns its handle
+IndexedHandle indexedInsert(IndexedHeap* h, int key) {
+    int handle;
+    if (h->freeCount > 0) {
+        handle = h->freeList[--h->freeCount];
+    } else {
+        handle = h->handleCount++;
+        heapReserve((void**)&h->keys, &h->keysCapacity, h->handleCount, sizeof(int));
+        heapReserve((void**)&h->pos, &h->posCapacity, h->handleCount, sizeof(int));
+        heapReserve((void**)&h->generation, &h->generationCapacity, h->handleCount,
+                    sizeof(unsigned int));
+        h->generation[handle] = 0;
+    }
+    heapReserve((void**)&h->heap, &h->heapCapacity, h->size + 1, sizeof(int));
+    h->keys[handle] = key;
+    h->heap[h->size] = handle;
+    h->pos[handle] = h->size;
+    h->size++;
+    indexedSiftUp(h, h->size - 1);
+    IndexedHandle result = {handle, h->generation[handle]};
+    return result;
+}
+
+// Detaches the handle at slot index and recycles it
+static void indexedRemoveAt(IndexedHeap* h, int index) {
+    int handle = h->heap[index];
+    h->pos[handle] = -1;
+    h->generation[handle]++;
+    heapReserve((void**)&h->freeList, &h->freeCapacity, h->freeCount + 1, sizeof(int));
+    h->freeList[h->freeCount++] = handle;
+
+    h->size--;
+    if (index == h->size) {
+        return;
+    }
+    int moved = h->heap[h->size];
+    h->heap[index] = moved;
+    h->pos[moved] = index;
+    // The moved item may belong above or below its new slot
+    indexedSiftUp(h, index);
+    if (h->pos[moved] == index) {
+        indexedSiftDown(h, index);
+    }
+}
+
+// Removes the minimum; stores its key and returns the handle it had, or
+// index -1 if empty. The returned handle is already stale.
+IndexedHandle indexedPopMin(IndexedHeap* h, int* key) {
+    IndexedHandle result = {-1, 0};
+    if (h->size == 0) {
+        printf("Heap is empty.\n");
+        return result;
+    }
+    result.index = h->heap[0];
+    result.generation = h->generation[result.index];
+    *key = h->keys[result.index];
+    indexedRemoveAt(h, 0);
+    return result;
+}
+
+// Lowers the key of a queued item; returns 0, or -1 on a bad handle or larger key
+int decreaseKey(IndexedHeap* h, IndexedHandle handle, int newKey) {
+    if (!indexedContains(h, handle) || newKey > h->keys[handle.index]) {
+        printf("Invalid decreaseKey.\n");
+        return -1;
+    }
+    h->keys[handle.index] = newKey;
+    indexedSiftUp(h, h->pos[handle.index]);
+    return 0;
+}
+
+// Raises the key of a queued item; returns 0, or -1 on a bad handle or smaller key
+int increaseKey(IndexedHeap* h, IndexedHandle handle, int newKey) {
+    if (!indexedContains(h, handle) || newKey < h->keys[handle.index]) {
+        printf("Invalid increaseKey.\n");
+        return -1;
+    }
+    h->keys[handle.index] = newKey;
+    indexedSiftDown(h, h->pos[handle.index]);
+    return 0;
+}
+
+// Removes a queued item; returns 0, or -1 on a bad handle
+int removeHandle(IndexedHeap* h, IndexedHandle handle) {
+    if (!indexedContains(h, handle)) {
+        printf("Invalid handle.\n");
+        return -1;
+    }
+    indexedRemoveAt(h, h->pos[handle.index]);
+    return 0;
+}
+
+// --- Benchmark: decrease-key vs. scan, delete and re-insert ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Old approach on a plain MinHeap: find the value by scanning, replace it
+// with the last element, restore order, then insert the new value
+void scanReplace(MinHeap* h, int oldKey, int newKey) {
+    for (int i = 0; i < h->size; i++) {
+        if (h->items[i] == oldKey) {
+            h->items[i] = h->items[--h->size];
+            if (i < h->size) {
+                MinHeap_siftUp(h, i);
+                MinHeap_siftDown(h, i);
+            }
+            break;
+        }
+    }
+    MinHeap_push(h, newKey);
+}
+
+void runBenchmark(int n, int updates) {
+    IndexedHeap ih;
+    MinHeap mh;
+    indexedInit(&ih);
+    MinHeap_init(&mh);
+    IndexedHandle* handles = (IndexedHandle*)malloc((size_t)n * sizeof(IndexedHandle));
+    int* keys = (int*)malloc((size_t)n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = 1000000000 - i * 7; // distinct keys
+        handles[i] = indexedInsert(&ih, keys[i]);
+        MinHeap_push(&mh, keys[i]);
+    }
+
+    unsigned int seed = 1;
+    double t = nowSeconds();
+    for (int u = 0; u < updates; u++) {
+        seed = seed * 1103515245u + 12345u;
+        int i = (int)((seed >> 8) % (unsigned int)n);
+        keys[i] -= 3 * n;
+        decreaseKey(&ih, handles[i], keys[i]);
+    }
+    printf("Indexed decreaseKey : %.3f s for %d updates\n", nowSeconds() - t, updates);
+
+    seed = 1;
+    t = nowSeconds();
+    for (int u = 0; u < updates; u++) {
+        seed = seed * 1103515245u + 12345u;
+        int i = (int)((seed >> 8) % (unsigned int)n);
+        int before = keys[i];
+        scanReplace(&mh, before, before - 3 * n);
+        keys[i] = before - 3 * n;
+    }
+    printf("Scan and re-insert  : %.3f s for %d updates\n", nowSeconds() - t, updates);
+
+    free(handles);
+    free(keys);
+    indexedFree(&ih);
+    MinHeap_free(&mh);
+}
+
+// Usage: Indexed_Heap [bench <items> <updates>]
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), atoi(argv[3]));
+        return 0;
+    }
+
+    // Dijkstra on a small graph: adjacency matrix, 0 means no edge
+    enum { V = 6 };
+    int graph[V][V] = {
+        {0, 7, 9, 0, 0, 14},
+        {7, 0, 10, 15, 0, 0},
+        {9, 10, 0, 11, 0, 2},
+        {0, 15, 11, 0, 6, 0},
+        {0, 0, 0, 6, 0, 9},
+        {14, 0, 2, 0, 9, 0},
+    };
+    const int INF = 1 << 30;
+    int dist[V], vertexOf[V];
+    IndexedHandle handleOf[V];
+    IndexedHeap pq;
+    indexedInit(&pq);
+    for (int v = 0; v < V; v++) {
+        dist[v] = v == 0 ? 0 : INF;
+        handleOf[v] = indexedInsert(&pq, dist[v]);
+        vertexOf[handleOf[v].index] = v;
+    }
+    while (pq.size > 0) {
+        int d;
+        int u = vertexOf[indexedPopMin(&pq, &d).index];
+        for (int v = 0; v < V; v++) {
+            if (graph[u][v] && indexedContains(&pq, handleOf[v]) && d + graph[u][v] < dist[v]) {
+                dist[v] = d + graph[u][v];
+                decreaseKey(&pq, handleOf[v], dist[v]);
+            }
+        }
+    }
+    printf("Shortest distances from vertex 0:");
+    for (int v = 0; v < V; v++) {
+        printf(" %d", dist[v]);
+    }
+    printf("\n");
+
+    // Priority changes and removal by handle
+    IndexedHandle a = indexedInsert(&pq, 50);
+    IndexedHandle b = indexedInsert(&pq, 40);
+    IndexedHandle c = indexedInsert(&pq, 30);
+    increaseKey(&pq, c, 60);
+    removeHandle(&pq, b);
+    int key;
+    indexedPopMin(&pq, &key);
+    printf("After raising 30 to 60 and removing 40, min is %d (handle %s)\n", key,
+           indexedContains(&pq, a) ? "still queued" : "popped");
+
+    // a's index is reused by the next insert, but a itself stays stale
+    IndexedHandle e = indexedInsert(&pq, 70);
+    printf("Index reused: %s, old handle %s\n", e.index == a.index ? "yes" : "no",
+           indexedContains(&pq, a) ? "accepted" : "rejected");
+    indexedFree(&pq);
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// A comparison function for qsort to sort in ascending order
+int compare(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// First index in arr[lo..hi) whose value is >= x
+int lowerBound(const int* arr, int lo, int hi, int x) {
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (arr[mid] < x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// First index in arr[lo..hi) whose value is > x
+int upperBound(const int* arr, int lo, int hi, int x) {
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (arr[mid] <= x) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Total number of values <= x across all shards
+long long countLessEqual(const int* const shards[], const int lengths[], int numShards, int x) {
+    long long count = 0;
+    for (int i = 0; i < numShards; i++) {
+        count += upperBound(shards[i], 0, lengths[i], x);
+    }
+    return count;
+}
+
+// Binary search over the value range: the answer is the smallest x with at
+// least k values <= x. Costs O(N log n) per step and 32 steps for int.
+// Returns 0, or -1 for an invalid k.
+int kthByValueSearch(const int* const shards[], const int lengths[], int numShards,
+                     long long k, int* result) {
+    long long total = 0;
+    long long lo = 0, hi = -1;
+    for (int i = 0; i < numShards; i++) {
+        if (lengths[i] == 0) continue;
+        if (hi < lo) {
+            lo = shards[i][0];
+            hi = shards[i][lengths[i] - 1];
+        }
+        if (shards[i][0] < lo) lo = shards[i][0];
+        if (shards[i][lengths[i] - 1] > hi) hi = shards[i][lengths[i] - 1];
+        total += lengths[i];
+    }
+    if (k < 1 || k > total) {
+        return -1;
+    }
+    while (lo < hi) {
+        long long mid = lo + (hi - lo) / 2;
+        if (countLessEqual(shards, lengths, numShards, (int)mid) >= k) hi = mid;
+        else lo = mid + 1;
+    }
+    *result = (int)lo;
+    return 0;
+}
+
+typedef struct {
+    int value;
+    int weight;
+} Candidate;
+
+static int compareCandidate(const void* a, const void* b) {
+    return compare(&((const Candidate*)a)->value, &((const Candidate*)b)->value);
+}
+
+// Per-shard partition search. Each shard keeps a window [lo, hi) that
+// still may hold the answer. Every round the pivot is the median of the
+// windows' middle elements weighted by window size, so at least a quarter
+// of the remaining candidates is discarded; each round costs two binary
+// searches per shard. Only the N window bounds and N pivot candidates are
+// allocated. Returns 0, or -1 for an invalid k.
+int kthByPartition(const int* const shards[], const int lengths[], int numShards,
+                   long long k, int* result) {
+    long long total = 0;
+    for (int i = 0; i < numShards; i++) {
+        total += lengths[i];
+    }
+    if (k < 1 || k > total) {
+        return -1;
+    }
+
+    int* lo = (int*)calloc(numShards, sizeof(int));
+    int* hi = (int*)malloc(numShards * sizeof(int));
+    int* lt = (int*)malloc(numShards * sizeof(int));
+    int* le = (int*)malloc(numShards * sizeof(int));
+    Candidate* cands = (Candidate*)malloc(numShards * sizeof(Candidate));
+    if (lo == NULL || hi == NULL || lt == NULL || le == NULL || cands == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    memcpy(hi, lengths, numShards * sizeof(int));
+
+    while (1) {
+        // Weighted median of window midpoints
+        int numCands = 0;
+        long long remaining = 0;
+        for (int i = 0; i < numShards; i++) {
+            int size = hi[i] - lo[i];
+            if (size > 0) {
+                cands[numCands].value = shards[i][lo[i] + size / 2];
+                cands[numCands].weight = size;
+                numCands++;
+                remaining += size;
+            }
+        }
+        qsort(cands, numCands, sizeof(Candidate), compareCandidate);
+        long long half = 0;
+        int pivot = cands[numCands - 1].value;
+        for (int c = 0; c < numCands; c++) {
+            half += cands[c].weight;
+            if (2 * half >= remaining) {
+                pivot = cands[c].value;
+                break;
+            }
+        }
+
+        // Count values below and equal to the pivot inside the windows
+        long long less = 0, equal = 0;
+        for (int i = 0; i < numShards; i++) {
+            lt[i] = lowerBound(shards[i], lo[i], hi[i], pivot);
+            le[i] = upperBound(shards[i], lt[i], hi[i], pivot);
+            less += lt[i] - lo[i];
+            equal += le[i] - lt[i];
+        }
+
+        if (k <= less) {
+            memcpy(hi, lt, numShards * sizeof(int));
+        } else if (k <= less + equal) {
+            *result = pivot;
+            break;
+        } else {
+            k -= less + equal;
+            memcpy(lo, le, numShards * sizeof(int));
+        }
+    }
+
+    free(lo);
+    free(hi);
+    free(lt);
+    free(le);
+    free(cands);
+    return 0;
+}
+
+int main() {
+    // Eight sorted shards of different sizes
+    const int numShards = 8;
+    int lengths[8] = {0, 1, 10, 1000, 37, 5000, 250, 3};
+    int* shards[8];
+    long long total = 0;
+    unsigned int seed = 99;
+    for (int i = 0; i < numShards; i++) {
+        shards[i] = (int*)malloc((lengths[i] > 0 ? lengths[i] : 1) * sizeof(int));
+        for (int j = 0; j < lengths[i]; j++) {
+            seed = seed * 1103515245u + 12345u;
+            shards[i][j] = (int)(seed >> 8) % 20000 - 10000;
+        }
+        qsort(shards[i], lengths[i], sizeof(int), compare);
+        total += lengths[i];
+    }
+
+    // Reference: concatenate and sort (what the shard APIs avoid)
+    int* all = (int*)malloc(total * sizeof(int));
+    int pos = 0;
+    for (int i = 0; i < numShards; i++) {
+        memcpy(all + pos, shards[i], lengths[i] * sizeof(int));
+        pos += lengths[i];
+    }
+    qsort(all, total, sizeof(int), compare);
+
+    long long ks[] = {1, 2, total / 4, total / 2, total - 1, total};
+    for (int i = 0; i < 6; i++) {
+        int byValue, byPartition;
+        kthByValueSearch((const int* const*)shards, lengths, numShards, ks[i], &byValue);
+        kthByPartition((const int* const*)shards, lengths, numShards, ks[i], &byPartition);
+        printf("k=%lld: value search %d, partition search %d, sorted %d\n",
+               ks[i], byValue, byPartition, all[ks[i] - 1]);
+    }
+
+    int unused;
+    if (kthByPartition((const int* const*)shards, lengths, numShards, total + 1, &unused) != 0) {
+        printf("k=%lld: Invalid value of K.\n", total + 1);
+    }
+
+    free(all);
+    for (int i = 0; i < numShards; i++) {
+        free(shards[i]);
+    }
+    return 0;
+}
@@ -1,34 +1,325 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-// A comparison function for qsort to sort in ascending order
+// A comparison function for qsort to sort in ascending order.
+// Comparing instead of subtracting avoids overflow on large-magnitude ints.
 int compare(const void *a, const void *b) {
-    return (*(int*)a - *(int*)b);
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Swaps two integers
+void swap(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// Sorts arr[lo..hi] by insertion (used for groups of five)
+void insertionSort(int arr[], int lo, int hi) {
+    for (int i = lo + 1; i <= hi; i++) {
+        int v = arr[i];
+        int j = i - 1;
+        while (j >= lo && arr[j] > v) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = v;
+    }
+}
+
+// Median of arr[lo], arr[mid], arr[hi]
+int medianOfThree(int arr[], int lo, int hi) {
+    int mid = lo + (hi - lo) / 2;
+    int a = arr[lo], b = arr[mid], c = arr[hi];
+    if (a < b) {
+        if (b < c) return b;
+        return a < c ? c : a;
+    }
+    if (a < c) return a;
+    return b < c ? c : b;
+}
+
+// Three-way partition of arr[lo..hi] around pivot. Afterwards
+// arr[lo..*lt-1] < pivot, arr[*lt..*gt] == pivot, arr[*gt+1..hi] > pivot.
+void partition3(int arr[], int lo, int hi, int pivot, int *lt, int *gt) {
+    int i = lo;
+    int l = lo, g = hi;
+    while (i <= g) {
+        if (arr[i] < pivot) {
+            swap(&arr[i++], &arr[l++]);
+        } else if (arr[i] > pivot) {
+            swap(&arr[i], &arr[g--]);
+        } else {
+            i++;
+        }
+    }
+    *lt = l;
+    *gt = g;
+}
+
+// Quickselect passes allowed to halve the range before giving up on median-of-3
+#define SHRINK_PASSES 4
+
+int momSelect(int arr[], int lo, int hi, int k);
+
+// Median of medians of groups of five: a pivot guaranteed to discard 30% per pass
+int medianOfMedians(int arr[], int lo, int hi) {
+    int store = lo;
+    for (int g = lo; g <= hi; g += 5) {
+        int end = g + 4 <= hi ? g + 4 : hi;
+        insertionSort(arr, g, end);
+        swap(&arr[store++], &arr[g + (end - g) / 2]);
+    }
+    int count = store - lo;
+    return momSelect(arr, lo, store - 1, lo + count / 2);
+}
+
+// Median-of-medians selection (same contract as selectRange). Every pivot
+// is a median of medians, so it is linear in the worst case.
+int momSelect(int arr[], int lo, int hi, int k) {
+    while (hi - lo >= 16) {
+        int pivot = medianOfMedians(arr, lo, hi);
+        int lt, gt;
+        partition3(arr, lo, hi, pivot, &lt, &gt);
+        if (k < lt) {
+            hi = lt - 1;
+        } else if (k > gt) {
+            lo = gt + 1;
+        } else {
+            return arr[k];
+        }
+    }
+    insertionSort(arr, lo, hi);
+    return arr[k];
+}
+
+// Introselect: places the element of (absolute) rank k of arr[lo..hi] at
+// arr[k] with smaller elements before it and larger ones after, and returns it.
+// Quickselect with a median-of-3 pivot runs as long as every SHRINK_PASSES
+// passes at least halve the range; the first time they do not, the rest is
+// handed to momSelect. The sizes worked on shrink geometrically either way,
+// so the worst case is O(n).
+int selectRange(int arr[], int lo, int hi, int k) {
+    int passes = 0;
+    int checkpoint = hi - lo + 1;
+    while (hi - lo >= 16) {
+        if (passes == SHRINK_PASSES) {
+            if (hi - lo + 1 > checkpoint / 2) {
+                return momSelect(arr, lo, hi, k);
+            }
+            passes = 0;
+            checkpoint = hi - lo + 1;
+        }
+        passes++;
+        int pivot = medianOfThree(arr, lo, hi);
+        int lt, gt;
+        partition3(arr, lo, hi, pivot, &lt, &gt);
+        if (k < lt) {
+            hi = lt - 1;
+        } else if (k > gt) {
+            lo = gt + 1;
+        } else {
+            return arr[k];
+        }
+    }
+    insertionSort(arr, lo, hi);
+    return arr[k];
+}
+
+// Partitions arr[lo..hi] and recurses only into the parts that still
+// contain requested ranks; ranks[from..to) are sorted 0-based ranks.
+// Pivots are median-of-3 under the same halving rule as selectRange; once
+// a range fails it (or linear is set) they are medians of medians.
+void multiSelectRange(int arr[], int lo, int hi, const int ranks[], int from, int to,
+                      int linear) {
+    int passes = 0;
+    int checkpoint = hi - lo + 1;
+    while (to - from > 1 && hi - lo >= 16) {
+        if (!linear && passes == SHRINK_PASSES) {
+            linear = hi - lo + 1 > checkpoint / 2;
+            passes = 0;
+            checkpoint = hi - lo + 1;
+        }
+        passes++;
+        int pivot = linear ? medianOfMedians(arr, lo, hi) : medianOfThree(arr, lo, hi);
+        int lt, gt;
+        partition3(arr, lo, hi, pivot, &lt, &gt);
+
+        // ranks[from..mid1) fall left of the pivot run, ranks[mid2..to) right of it
+        int mid1 = from;
+        while (mid1 < to && ranks[mid1] < lt) mid1++;
+        int mid2 = mid1;
+        while (mid2 < to && ranks[mid2] <= gt) mid2++;
+
+        // Recurse into the smaller side, loop on the larger one
+        if (mid1 - from < to - mid2) {
+            multiSelectRange(arr, lo, lt - 1, ranks, from, mid1, linear);
+            lo = gt + 1;
+            from = mid2;
+        } else {
+            multiSelectRange(arr, gt + 1, hi, ranks, mid2, to, linear);
+            hi = lt - 1;
+            to = mid1;
+        }
+    }
+    if (to - from == 1) {
+        if (linear) {
+            momSelect(arr, lo, hi, ranks[from]);
+        } else {
+            selectRange(arr, lo, hi, ranks[from]);
+        }
+    } else if (to - from > 1) {
+        insertionSort(arr, lo, hi);
+    }
+}
+
+// Answers several order-statistic queries at once (reorders arr).
+// ks holds 1-based ranks in ascending order; results[i] receives the
+// ks[i]th smallest element. Returns 0, or -1 if a rank is invalid.
+int multiSelect(int arr[], int n, const int ks[], int numKs, int results[]) {
+    int* ranks = (int*)calloc((size_t)(numKs > 0 ? numKs : 1), sizeof(int));
+    if (ranks == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (int i = 0; i < numKs; i++) {
+        if (ks[i] < 1 || ks[i] > n || (i > 0 && ks[i] < ks[i - 1])) {
+            free(ranks);
+            return -1;
+        }
+        ranks[i] = ks[i] - 1;
+    }
+    multiSelectRange(arr, 0, n - 1, ranks, 0, numKs, 0);
+    for (int i = 0; i < numKs; i++) {
+        results[i] = arr[ranks[i]];
+    }
+    free(ranks);
+    return 0;
+}
+
+// Finds the kth smallest and kth largest elements (reorders arr).
+// The lower rank is selected first; the higher one is then searched only in
+// the part of the array after it. Returns 0, or -1 for invalid k.
+int kthSmallestAndLargest(int arr[], int n, int k, int *smallest, int *largest) {
+    if (k < 1 || k > n) {
+        return -1;
+    }
+    int rankSmall = k - 1;
+    int rankLarge = n - k;
+    int lower = rankSmall < rankLarge ? rankSmall : rankLarge;
+    int upper = rankSmall < rankLarge ? rankLarge : rankSmall;
+    selectRange(arr, 0, n - 1, lower);
+    if (upper > lower) {
+        selectRange(arr, lower + 1, n - 1, upper);
+    }
+    *smallest = arr[rankSmall];
+    *largest = arr[rankLarge];
+    return 0;
 }
 
 void findKthElements(int arr[], int n, int k) {
+    int smallest, largest;
+
     // Check if k is a valid index
-    if (k < 1 || k > n) {
+    if (kthSmallestAndLargest(arr, n, k, &smallest, &largest) != 0) {
         printf("Invalid value of K.\n");
         return;
     }
 
-    // Sort the array in ascending order
-    qsort(arr, n, sizeof(int), compare);
+    printf("The %dth smallest element is: %d\n", k, smallest);
+    printf("The %dth largest element is: %d\n", k, largest);
+}
 
-    // Kth smallest element is at index k-1
-    printf("The %dth smallest element is: %d\n", k, arr[k - 1]);
+// --- Benchmark ---
 
-    // Kth largest element is at index n-k
-    printf("The %dth largest element is: %d\n", k, arr[n - k]);
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
 }
 
-int main() {
+// Times qsort against introselect on n random ints of full 32-bit range
+void runBenchmark(int n, int k) {
+    if (n < 1 || k < 1 || k > n) {
+        printf("Invalid value of K.\n");
+        return;
+    }
+    int* data = (int*)malloc((size_t)n * sizeof(int));
+    int* work = (int*)malloc((size_t)n * sizeof(int));
+    if (data == NULL || work == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    unsigned int seed = 12345;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (int)seed;
+    }
+
+    memcpy(work, data, (size_t)n * sizeof(int));
+    double t = nowSeconds();
+    qsort(work, n, sizeof(int), compare);
+    int sortSmall = work[k - 1], sortLarge = work[n - k];
+    printf("qsort       : %.3f s\n", nowSeconds() - t);
+
+    memcpy(work, data, (size_t)n * sizeof(int));
+    int small, large;
+    t = nowSeconds();
+    kthSmallestAndLargest(work, n, k, &small, &large);
+    printf("introselect : %.3f s  %s\n", nowSeconds() - t,
+           small == sortSmall && large == sortLarge ? "results match" : "RESULTS DIFFER");
+
+    // 1st, 5th, 50th, 95th and 99th percentiles
+    int percents[] = {1, 5, 50, 95, 99};
+    int numKs = sizeof(percents) / sizeof(percents[0]);
+    int ks[5], separate[5], together[5];
+    for (int i = 0; i < numKs; i++) {
+        ks[i] = (int)((long long)n * percents[i] / 100);
+        if (ks[i] < 1) ks[i] = 1;
+    }
+
+    // Copies stay outside the timed regions of both variants
+    double separateTime = 0;
+    for (int i = 0; i < numKs; i++) {
+        memcpy(work, data, (size_t)n * sizeof(int));
+        t = nowSeconds();
+        separate[i] = selectRange(work, 0, n - 1, ks[i] - 1);
+        separateTime += nowSeconds() - t;
+    }
+    printf("5 selects   : %.3f s\n", separateTime);
+
+    memcpy(work, data, (size_t)n * sizeof(int));
+    t = nowSeconds();
+    multiSelect(work, n, ks, numKs, together);
+    printf("multiSelect : %.3f s  %s\n", nowSeconds() - t,
+           memcmp(separate, together, sizeof(separate)) == 0 ? "results match" : "RESULTS DIFFER");
+
+    free(data);
+    free(work);
+}
+
+// Usage: Largest_Smallest [bench <n> [k]]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        int n = atoi(argv[2]);
+        runBenchmark(n, argc >= 4 ? atoi(argv[3]) : n / 100 + 1);
+        return 0;
+    }
+
     int arr[] = {12, 3, 5, 7, 4, 19, 26};
     int n = sizeof(arr) / sizeof(arr[0]);
     int k = 3;
 
     findKthElements(arr, n, k);
 
+    int ks[] = {1, 4, 7};
+    int results[3];
+    multiSelect(arr, n, ks, 3, results);
+    printf("Ranks 1, 4, 7 (min, median, max): %d %d %d\n", results[0], results[1], results[2]);
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,303 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#endif
+
+#define READ_BUFFER_BYTES (1 << 20)  // per run
+#define WRITE_BUFFER_BYTES (8 << 20)
+
+// Sequential reader over one sorted run of native-endian int32 values
+typedef struct {
+    FILE* file;
+    int32_t* buffer;
+    size_t count; // values in buffer
+    size_t pos;
+    int exhausted;
+    int failed;   // a read error ended the run early
+    int32_t current;
+} RunReader;
+
+// Tournament tree of losers over k runs. Leaves are the runs; each
+// internal node tree[1..k-1] keeps the run that lost the match played
+// there and tree[0] keeps the overall winner. Replacing the winner's value
+// replays only its leaf-to-root path: one comparison per level.
+typedef struct {
+    int k;
+    int* tree;
+    int64_t* keys; // keys[run]: current value and run index packed, see runKey
+    RunReader* runs;
+} LoserTree;
+
+// --- Run I/O ---
+
+static void refill(RunReader* r) {
+    r->count = fread(r->buffer, sizeof(int32_t), READ_BUFFER_BYTES / sizeof(int32_t), r->file);
+    r->pos = 0;
+    if (r->count == 0 && ferror(r->file)) {
+        perror("Read failed");
+        r->failed = 1;
+    }
+}
+
+// Advances to the next value; sets exhausted at end of run
+static void advance(RunReader* r) {
+    if (r->pos == r->count) {
+        refill(r);
+        if (r->count == 0) {
+            r->exhausted = 1;
+            return;
+        }
+    }
+    r->current = r->buffer[r->pos++];
+}
+
+int openRun(RunReader* r, const char* path) {
+    r->file = fopen(path, "rb");
+    if (r->file == NULL) {
+        perror(path);
+        return -1;
+    }
+#ifndef _WIN32
+    // Ask the kernel to read ahead aggressively on this sequential stream
+    posix_fadvise(fileno(r->file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    setvbuf(r->file, NULL, _IONBF, 0); // our own buffer is already large
+    r->buffer = (int32_t*)malloc(READ_BUFFER_BYTES);
+    if (r->buffer == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    r->count = r->pos = 0;
+    r->exhausted = 0;
+    r->failed = 0;
+    advance(r);
+    return 0;
+}
+
+void closeRun(RunReader* r) {
+    fclose(r->file);
+    free(r->buffer);
+}
+
+// --- Loser tree ---
+
+// Packs a run's current value above its index so one 64-bit compare
+// orders by value and breaks ties by run; exhausted runs sort last
+static int64_t runKey(const RunReader* r, int run) {
+    if (r->exhausted) return INT64_MAX;
+    return (int64_t)r->current * ((int64_t)1 << 32) + run;
+}
+
+// True when run a's current value comes before run b's
+static int beats(const LoserTree* lt, int a, int b) {
+    return lt->keys[a] < lt->keys[b];
+}
+
+void buildLoserTree(LoserTree* lt, RunReader* runs, int k) {
+    lt->k = k;
+    lt->runs = runs;
+    lt->tree = (int*)malloc((size_t)(k > 1 ? k : 2) * sizeof(int));
+    lt->keys = (int64_t*)malloc((size_t)(k > 0 ? k : 1) * sizeof(int64_t));
+    if (lt->tree == NULL || lt->keys == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (int i = 0; i < k; i++) {
+        lt->tree[i] = -1;
+        lt->keys[i] = runKey(&runs[i], i);
+    }
+    // Insert each leaf: it climbs until it finds an empty node to wait in
+    for (int run = 0; run < k; run++) {
+        int winner = run;
+        int node = (run + k) / 2;
+        while (node > 0 && lt->tree[node] != -1) {
+            if (beats(lt, lt->tree[node], winner)) {
+                int t = lt->tree[node];
+                lt->tree[node] = winner;
+                winner = t;
+            }
+            node /= 2;
+        }
+        if (node > 0) {
+            lt->tree[node] = winner;
+        } else {
+            lt->tree[0] = winner;
+        }
+    }
+    if (k == 1) {
+        lt->tree[0] = 0;
+    }
+}
+
+// Replays the path of the winner after its run advanced
+static void replay(LoserTree* lt) {
+    int winner = lt->tree[0];
+    lt->keys[winner] = runKey(&lt->runs[winner], winner);
+    for (int node = (winner + lt->k) / 2; node > 0; node /= 2) {
+        // Selects instead of branching: match outcomes are unpredictable
+        int loser = lt->tree[node];
+        int swapped = beats(lt, loser, winner);
+        lt->tree[node] = swapped ? winner : loser;
+        winner = swapped ? loser : winner;
+    }
+    lt->tree[0] = winner;
+}
+
+// Merges the sorted run files into outPath; returns values written, or -1
+// on any open, read, write or allocation failure
+long long mergeRuns(char* const paths[], int k, const char* outPath) {
+    RunReader* runs = (RunReader*)calloc((size_t)k, sizeof(RunReader));
+    if (runs == NULL) {
+        perror("Memory allocation failed");
+        return -1;
+    }
+    for (int i = 0; i < k; i++) {
+        if (openRun(&runs[i], paths[i]) != 0) {
+            for (int j = 0; j < i; j++) closeRun(&runs[j]);
+            free(runs);
+            return -1;
+        }
+    }
+    FILE* out = fopen(outPath, "wb");
+    if (out == NULL) {
+        perror(outPath);
+        for (int i = 0; i < k; i++) closeRun(&runs[i]);
+        free(runs);
+        return -1;
+    }
+    setvbuf(out, NULL, _IONBF, 0);
+    int32_t* block = (int32_t*)malloc(WRITE_BUFFER_BYTES);
+    if (block == NULL) {
+        perror("Memory allocation failed");
+        fclose(out);
+        for (int i = 0; i < k; i++) closeRun(&runs[i]);
+        free(runs);
+        return -1;
+    }
+    size_t blockCap = WRITE_BUFFER_BYTES / sizeof(int32_t), blockLen = 0;
+    long long written = 0;
+    int ok = 1;
+
+    LoserTree lt;
+    buildLoserTree(&lt, runs, k);
+    while (k > 0 && lt.keys[lt.tree[0]] != INT64_MAX) {
+        RunReader* w = &runs[lt.tree[0]];
+        block[blockLen++] = w->current;
+        if (blockLen == blockCap) {
+            if (fwrite(block, sizeof(int32_t), blockLen, out) != blockLen) {
+                perror("Write failed");
+                ok = 0;
+                break;
+            }
+            written += blockLen;
+            blockLen = 0;
+        }
+        advance(w);
+        replay(&lt);
+    }
+    if (ok && blockLen > 0 && fwrite(block, sizeof(int32_t), blockLen, out) != blockLen) {
+        perror("Write failed");
+        ok = 0;
+    }
+    written += blockLen;
+
+    if (fclose(out) != 0) ok = 0;
+    for (int i = 0; i < k; i++) {
+        if (runs[i].failed) ok = 0;
+        closeRun(&runs[i]);
+    }
+    free(runs);
+    free(block);
+    free(lt.tree);
+    free(lt.keys);
+    return ok ? written : -1;
+}
+
+// --- Test data ---
+
+// Writes a sorted run of count values with random gaps
+int writeRun(const char* path, long count, unsigned int seed) {
+    FILE* f = fopen(path, "wb");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    int32_t chunk[4096];
+    int32_t value = -1000000000;
+    for (long done = 0; done < count; ) {
+        int n = count - done < 4096 ? (int)(count - done) : 4096;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            value += (int32_t)((seed >> 16) % 64);
+            chunk[i] = value;
+        }
+        if (fwrite(chunk, sizeof(int32_t), n, f) != (size_t)n) {
+            perror("Write failed");
+            fclose(f);
+            return -1;
+        }
+        done += n;
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Usage:
+//   Loser_Tree_Merge gen <prefix> <runs> <values per run>   writes <prefix>0.bin ...
+//   Loser_Tree_Merge merge <output> <run files...>
+//   Loser_Tree_Merge                                       small self-check
+int main(int argc, char* argv[]) {
+    if (argc == 5 && strcmp(argv[1], "gen") == 0) {
+        int runs = atoi(argv[3]);
+        char path[4096];
+        for (int i = 0; i < runs; i++) {
+            snprintf(path, sizeof(path), "%s%d.bin", argv[2], i);
+            if (writeRun(path, atol(argv[4]), 17u + (unsigned int)i) != 0) return 1;
+        }
+        return 0;
+    }
+    if (argc >= 4 && strcmp(argv[1], "merge") == 0) {
+        double t = nowSeconds();
+        long long n = mergeRuns(argv + 3, argc - 3, argv[2]);
+        if (n < 0) return 1;
+        double elapsed = nowSeconds() - t;
+        printf("Merged %d runs, %lld values in %.3f s: %.1f MB/s\n", argc - 3, n, elapsed,
+               n * sizeof(int32_t) / elapsed / 1e6);
+        return 0;
+    }
+
+    // Self-check: merge 7 small runs and confirm the output is sorted
+    char names[7][32];
+    char* paths[7];
+    for (int i = 0; i < 7; i++) {
+        snprintf(names[i], sizeof(names[i]), "run_demo%d.bin", i);
+        paths[i] = names[i];
+        writeRun(paths[i], 10000 + 3 * i, 100u + (unsigned int)i);
+    }
+    long long n = mergeRuns(paths, 7, "merged_demo.bin");
+    FILE* f = fopen("merged_demo.bin", "rb");
+    int32_t prev = INT32_MIN, v;
+    long long count = 0, inversions = 0;
+    while (f && fread(&v, sizeof(v), 1, f) == 1) {
+        inversions += v < prev;
+        prev = v;
+        count++;
+    }
+    if (f) fclose(f);
+    printf("Merged %lld values (read back %lld), %s\n", n, count,
+           inversions ? "NOT SORTED" : "sorted");
+    for (int i = 0; i < 7; i++) remove(paths[i]);
+    remove("merged_demo.bin");
+    return 0;
+}
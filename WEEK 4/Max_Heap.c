@@ -1,75 +1,60 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Heap.h"
 
-#define MAX_SIZE 100
+#define GREATER(a, b) ((a) > (b))
 
-// Heap structure to encapsulate data and size
-typedef struct {
-    int items[MAX_SIZE];
-    int size;
-} MaxHeap;
+// Max-heap of ints generated from the shared heap library
+DEFINE_HEAP(MaxHeap, int, GREATER)
 
 // Initializes the heap
 void initializeHeap(MaxHeap* h) {
-    h->size = 0;
+    MaxHeap_init(h);
 }
 
-// Swaps two integers
-void swap(int *a, int *b) {
-    int temp = *a;
-    *a = *b;
-    *b = temp;
+// Inserts an element into the heap; storage grows as needed
+void insert(MaxHeap* h, int value) {
+    MaxHeap_push(h, value);
 }
 
-// Moves an element up the heap to maintain the max-heap property
-void heapifyUp(MaxHeap* h, int index) {
-    while (index > 0 && h->items[index] > h->items[(index - 1) / 2]) {
-        swap(&h->items[index], &h->items[(index - 1) / 2]);
-        index = (index - 1) / 2;
+// Deletes the maximum element (root) from the heap
+int deleteMax(MaxHeap* h) {
+    if (MaxHeap_isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
     }
+    return MaxHeap_pop(h);
 }
 
-// Moves an element down the heap to maintain the max-heap property
-void heapifyDown(MaxHeap* h, int index) {
-    int largest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
+// Builds the heap from an array in O(n)
+void buildHeap(MaxHeap* h, const int values[], int n) {
+    MaxHeap_build(h, values, n);
+}
 
-    if (left < h->size && h->items[left] > h->items[largest]) {
-        largest = left;
-    }
-    if (right < h->size && h->items[right] > h->items[largest]) {
-        largest = right;
+// Removes the maximum and inserts value with a single sift-down
+int replaceMax(MaxHeap* h, int value) {
+    if (MaxHeap_isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
     }
+    return MaxHeap_replaceTop(h, value);
+}
 
-    if (largest != index) {
-        swap(&h->items[index], &h->items[largest]);
-        heapifyDown(h, largest);
-    }
+// Inserts value, then removes and returns the maximum
+int pushPop(MaxHeap* h, int value) {
+    return MaxHeap_pushPop(h, value);
 }
 
-// Inserts an element into the heap
-void insert(MaxHeap* h, int value) {
-    if (h->size >= MAX_SIZE) {
-        printf("Heap is full.\n");
-        return;
-    }
-    h->items[h->size] = value;
-    heapifyUp(h, h->size);
-    h->size++;
+// Extracts the k largest elements into out, largest first; returns how many
+int popMany(MaxHeap* h, int k, int out[]) {
+    return MaxHeap_popMany(h, k, out);
 }
 
-// Deletes the maximum element (root) from the heap
-int deleteMax(MaxHeap* h) {
-    if (h->size <= 0) {
-        printf("Heap is empty.\n");
-        return -1;
-    }
-    int maxVal = h->items[0];
-    h->items[0] = h->items[h->size - 1];
-    h->size--;
-    heapifyDown(h, 0);
-    return maxVal;
+// Sorts the heap's storage ascending in place and empties the heap
+int heapSort(MaxHeap* h) {
+    return MaxHeap_sortInPlace(h);
 }
 
 // Prints the heap elements
@@ -81,7 +66,85 @@ void printHeap(MaxHeap* h) {
     printf("\n");
 }
 
-int main() {
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Compares the combined operations with deleteMax + insert on n elements
+void runBenchmark(int n, int ops) {
+    if (n < 1 || ops < 0) {
+        printf("Usage: Max_Heap bench <heap size >= 1> <operations >= 0>\n");
+        return;
+    }
+    int* values = (int*)malloc((size_t)n * sizeof(int));
+    int* out = (int*)malloc((size_t)n * sizeof(int));
+    if (values == NULL || out == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    unsigned int seed = 3;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        values[i] = (int)(seed >> 1);
+    }
+    MaxHeap h;
+    initializeHeap(&h);
+    long long checksum = 0;
+    double t;
+
+    buildHeap(&h, values, n);
+    t = nowSeconds();
+    for (int i = 0; i < ops; i++) {
+        checksum += deleteMax(&h);
+        insert(&h, values[i % n] >> 1);
+    }
+    printf("deleteMax + insert : %.3f s (checksum %lld)\n", nowSeconds() - t, checksum);
+
+    checksum = 0;
+    buildHeap(&h, values, n);
+    t = nowSeconds();
+    for (int i = 0; i < ops; i++) {
+        checksum += replaceMax(&h, values[i % n] >> 1);
+    }
+    printf("replaceMax         : %.3f s (checksum %lld)\n", nowSeconds() - t, checksum);
+
+    buildHeap(&h, values, n);
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        out[i] = deleteMax(&h);
+    }
+    printf("n x deleteMax      : %.3f s\n", nowSeconds() - t);
+
+    buildHeap(&h, values, n);
+    t = nowSeconds();
+    popMany(&h, n, out);
+    printf("popMany(n)         : %.3f s\n", nowSeconds() - t);
+
+    buildHeap(&h, values, n);
+    t = nowSeconds();
+    heapSort(&h);
+    printf("heapSort in place  : %.3f s\n", nowSeconds() - t);
+    for (int i = 1; i < n; i++) {
+        if (h.items[i - 1] > h.items[i]) {
+            printf("heapSort output is not sorted!\n");
+            break;
+        }
+    }
+
+    MaxHeap_free(&h);
+    free(values);
+    free(out);
+}
+
+// Usage: Max_Heap [bench <heap size> <operations>]
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), atoi(argv[3]));
+        return 0;
+    }
+
     MaxHeap myHeap;
     initializeHeap(&myHeap);
 
@@ -93,5 +156,26 @@ int main() {
     printf("Deleted max element: %d\n", deleteMax(&myHeap));
     printHeap(&myHeap);
 
+    int values[] = {3, 9, 2, 1, 4, 5, 12, 7};
+    buildHeap(&myHeap, values, sizeof(values) / sizeof(values[0]));
+    printf("Built from array: ");
+    printHeap(&myHeap);
+
+    printf("Replaced max %d with 6: ", replaceMax(&myHeap, 6));
+    printHeap(&myHeap);
+    printf("pushPop(20) returns %d\n", pushPop(&myHeap, 20));
+
+    int top[3];
+    int count = popMany(&myHeap, 3, top);
+    printf("Top %d popped: %d %d %d\n", count, top[0], top[1], top[2]);
+
+    int n = heapSort(&myHeap);
+    printf("Heapsorted remainder: ");
+    for (int i = 0; i < n; i++) {
+        printf("%d ", myHeap.items[i]);
+    }
+    printf("\n");
+
+    MaxHeap_free(&myHeap);
     return 0;
-}
\ No newline at end of file
+}
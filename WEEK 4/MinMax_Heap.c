@@ -0,0 +1,230 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Heap.h"
+
+// Double-ended priority queue. Even levels (the root is level 0) are min
+// levels and odd levels are max levels: every node is <= all of its
+// descendants on a min level and >= all of them on a max level. The
+// minimum is the root and the maximum is one of the root's children.
+typedef enum {
+    UNBOUNDED,
+    EVICT_MIN, // when full, drop the smallest value: keeps the largest `bound`
+    EVICT_MAX  // when full, drop the largest value: keeps the smallest `bound`
+} EvictPolicy;
+
+typedef struct {
+    int* items;
+    int size;
+    int capacity; // allocated slots, grown with heapReserve
+    int bound;    // maximum size when policy != UNBOUNDED
+    EvictPolicy policy;
+} MinMaxHeap;
+
+// Swaps two integers
+void swap(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void initializeHeap(MinMaxHeap* h, EvictPolicy policy, int bound) {
+    h->items = NULL;
+    h->size = 0;
+    h->capacity = 0;
+    h->policy = policy;
+    h->bound = bound;
+}
+
+void freeHeap(MinMaxHeap* h) {
+    free(h->items);
+    h->items = NULL;
+    h->size = h->capacity = 0;
+}
+
+// True when index lies on a min level
+int isMinLevel(int index) {
+    int level = 0;
+    for (index++; index > 1; index >>= 1) {
+        level++;
+    }
+    return level % 2 == 0;
+}
+
+// Orders a and b for the level type: a < b on min levels, a > b on max levels
+static int beats(int a, int b, int minLevel) {
+    return minLevel ? a < b : a > b;
+}
+
+// Moves items[index] up through grandparents of the same level type
+void pushUpSameLevel(MinMaxHeap* h, int index, int minLevel) {
+    while (index > 2) {
+        int grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!beats(h->items[index], h->items[grandparent], minLevel)) break;
+        swap(&h->items[index], &h->items[grandparent]);
+        index = grandparent;
+    }
+}
+
+void pushUp(MinMaxHeap* h, int index) {
+    if (index == 0) return;
+    int parent = (index - 1) / 2;
+    int minLevel = isMinLevel(index);
+    if (beats(h->items[parent], h->items[index], minLevel)) {
+        // Belongs on the other kind of level: step to the parent first
+        swap(&h->items[index], &h->items[parent]);
+        pushUpSameLevel(h, parent, !minLevel);
+    } else {
+        pushUpSameLevel(h, index, minLevel);
+    }
+}
+
+// Restores order below index by comparing children and grandchildren
+void pushDown(MinMaxHeap* h, int index) {
+    int minLevel = isMinLevel(index);
+    while (1) {
+        int first = 2 * index + 1;
+        if (first >= h->size) return;
+
+        // Best among up to two children and four grandchildren
+        int best = first;
+        int candidates[6] = {first, first + 1, 2 * first + 1, 2 * first + 2,
+                             2 * first + 3, 2 * first + 4};
+        for (int c = 1; c < 6; c++) {
+            if (candidates[c] < h->size && beats(h->items[candidates[c]], h->items[best], minLevel)) {
+                best = candidates[c];
+            }
+        }
+        if (!beats(h->items[best], h->items[index], minLevel)) return;
+
+        swap(&h->items[best], &h->items[index]);
+        if (best <= first + 1) return; // a child: nothing below it can be out of order
+
+        int parent = (best - 1) / 2;
+        if (beats(h->items[parent], h->items[best], minLevel)) {
+            swap(&h->items[best], &h->items[parent]);
+        }
+        index = best;
+    }
+}
+
+int isEmpty(MinMaxHeap* h) {
+    return h->size == 0;
+}
+
+// Index of the maximum element; the heap must not be empty
+static int maxIndex(MinMaxHeap* h) {
+    if (h->size == 1) return 0;
+    if (h->size == 2) return 1;
+    return h->items[1] > h->items[2] ? 1 : 2;
+}
+
+int findMin(MinMaxHeap* h) {
+    if (isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    return h->items[0];
+}
+
+int findMax(MinMaxHeap* h) {
+    if (isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    return h->items[maxIndex(h)];
+}
+
+// Removes the element at index by moving the last one into its place
+static void removeAt(MinMaxHeap* h, int index) {
+    h->size--;
+    if (index < h->size) {
+        h->items[index] = h->items[h->size];
+        pushDown(h, index);
+    }
+}
+
+int deleteMin(MinMaxHeap* h) {
+    if (isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    int minVal = h->items[0];
+    removeAt(h, 0);
+    return minVal;
+}
+
+int deleteMax(MinMaxHeap* h) {
+    if (isEmpty(h)) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    int index = maxIndex(h);
+    int maxVal = h->items[index];
+    removeAt(h, index);
+    return maxVal;
+}
+
+// Appends value and moves it to its level
+static void pushValue(MinMaxHeap* h, int value) {
+    heapReserve((void**)&h->items, &h->capacity, h->size + 1, sizeof(int));
+    h->items[h->size] = value;
+    pushUp(h, h->size);
+    h->size++;
+}
+
+// Inserts value. In a bounded heap that is full, the extreme named by the
+// policy is evicted (possibly value itself); returns 1 and stores it in
+// *evicted in that case, 0 otherwise.
+int insert(MinMaxHeap* h, int value, int* evicted) {
+    if (h->policy == UNBOUNDED || h->size < h->bound) {
+        pushValue(h, value);
+        return 0;
+    }
+    if (h->size == 0
+        || (h->policy == EVICT_MIN && value <= h->items[0])
+        || (h->policy == EVICT_MAX && value >= h->items[maxIndex(h)])) {
+        *evicted = value;
+        return 1;
+    }
+    *evicted = h->policy == EVICT_MIN ? deleteMin(h) : deleteMax(h);
+    pushValue(h, value);
+    return 1;
+}
+
+// Prints heap elements
+void printHeap(MinMaxHeap* h) {
+    printf("Min-Max heap elements: ");
+    for (int i = 0; i < h->size; i++) {
+        printf("%d ", h->items[i]);
+    }
+    printf("\n");
+}
+
+int main() {
+    MinMaxHeap myHeap;
+    int evicted;
+    initializeHeap(&myHeap, UNBOUNDED, 0);
+
+    int values[] = {10, 5, 15, 3, 8, 20, 1, 12};
+    for (int i = 0; i < 8; i++) {
+        insert(&myHeap, values[i], &evicted);
+    }
+    printHeap(&myHeap);
+    printf("Min: %d, Max: %d\n", findMin(&myHeap), findMax(&myHeap));
+    printf("Deleted min element: %d\n", deleteMin(&myHeap));
+    printf("Deleted max element: %d\n", deleteMax(&myHeap));
+    printHeap(&myHeap);
+    freeHeap(&myHeap);
+
+    // Keep only the 3 largest values seen
+    initializeHeap(&myHeap, EVICT_MIN, 3);
+    for (int i = 0; i < 8; i++) {
+        if (insert(&myHeap, values[i], &evicted)) {
+            printf("Inserting %d evicted %d\n", values[i], evicted);
+        }
+    }
+    printf("3 largest: min %d, max %d\n", findMin(&myHeap), findMax(&myHeap));
+    freeHeap(&myHeap);
+
+    return 0;
+}
@@ -1,78 +1,37 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "Heap.h"
 
-#define MAX_SIZE 100
+#define LESS(a, b) ((a) < (b))
 
-// Heap structure
-typedef struct {
-    int items[MAX_SIZE];
-    int size;
-} MinHeap;
+// Min-heap of ints generated from the shared heap library
+DEFINE_HEAP(MinHeap, int, LESS)
 
 // Initializes the heap
 void initializeHeap(MinHeap* h) {
-    h->size = 0;
+    MinHeap_init(h);
 }
 
-// Swaps two integers
-void swap(int *a, int *b) {
-    int temp = *a;
-    *a = *b;
-    *b = temp;
-}
-
-// Moves an element up the heap
-void heapifyUp(MinHeap* h, int index) {
-    while (index > 0 && h->items[index] < h->items[(index - 1) / 2]) {
-        swap(&h->items[index], &h->items[(index - 1) / 2]);
-        index = (index - 1) / 2;
-    }
-}
-
-// Moves an element down the heap
-void heapifyDown(MinHeap* h, int index) {
-    int smallest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-
-    if (left < h->size && h->items[left] < h->items[smallest]) {
-        smallest = left;
-    }
-    if (right < h->size && h->items[right] < h->items[smallest]) {
-        smallest = right;
-    }
-
-    if (smallest != index) {
-        swap(&h->items[index], &h->items[smallest]);
-        heapifyDown(h, smallest);
-    }
-}
-
-// Inserts an element
+// Inserts an element into the heap; storage grows as needed
 void insert(MinHeap* h, int value) {
-    if (h->size >= MAX_SIZE) {
-        printf("Heap is full.\n");
-        return;
-    }
-    h->items[h->size] = value;
-    heapifyUp(h, h->size);
-    h->size++;
+    MinHeap_push(h, value);
 }
 
-// Deletes the minimum element
+// Deletes the minimum element (root) from the heap
 int deleteMin(MinHeap* h) {
-    if (h->size <= 0) {
+    if (MinHeap_isEmpty(h)) {
         printf("Heap is empty.\n");
         return -1;
     }
-    int minVal = h->items[0];
-    h->items[0] = h->items[h->size - 1];
-    h->size--;
-    heapifyDown(h, 0);
-    return minVal;
+    return MinHeap_pop(h);
 }
 
-// Prints heap elements
+// Builds the heap from an array in O(n)
+void buildHeap(MinHeap* h, const int values[], int n) {
+    MinHeap_build(h, values, n);
+}
+
+// Prints the heap elements
 void printHeap(MinHeap* h) {
     printf("Min-Heap elements: ");
     for (int i = 0; i < h->size; i++) {
@@ -93,5 +52,11 @@ int main() {
     printf("Deleted min element: %d\n", deleteMin(&myHeap));
     printHeap(&myHeap);
 
+    int values[] = {3, 9, 2, 1, 4, 5, 12, 7};
+    buildHeap(&myHeap, values, sizeof(values) / sizeof(values[0]));
+    printf("Built from array: ");
+    printHeap(&myHeap);
+
+    MinHeap_free(&myHeap);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdalign.h>
+#include "Heap.h"
+
+#define LESS(a, b) ((a) < (b))
+DEFINE_HEAP(MinHeap, int, LESS)
+
+// Wider than any int key, so an inserted INT_MAX never looks like an empty queue
+#define EMPTY_TOP LLONG_MAX
+
+// One locked heap, padded to its own cache line. top caches the minimum
+// so that pops can compare two queues without locking either.
+typedef struct {
+    alignas(64) pthread_mutex_t lock;
+    MinHeap heap;
+    atomic_llong top;
+} LockedQueue;
+
+// Relaxed concurrent min-priority queue (MultiQueue). Values go to a
+// random queue; deleteMin samples two queues and pops from the one with
+// the smaller top. With q = queuesPerThread * threads queues the popped
+// element's rank is O(q) in expectation, so queuesPerThread is the
+// relaxation knob: more queues means less lock contention but looser order.
+typedef struct {
+    LockedQueue* queues;
+    int numQueues;
+} MultiQueue;
+
+void multiQueueInit(MultiQueue* mq, int threads, int queuesPerThread) {
+    mq->numQueues = threads * queuesPerThread;
+    if (mq->numQueues < 2) mq->numQueues = 2;
+    mq->queues = (LockedQueue*)aligned_alloc(64, mq->numQueues * sizeof(LockedQueue));
+    if (mq->queues == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (int i = 0; i < mq->numQueues; i++) {
+        pthread_mutex_init(&mq->queues[i].lock, NULL);
+        MinHeap_init(&mq->queues[i].heap);
+        atomic_init(&mq->queues[i].top, EMPTY_TOP);
+    }
+}
+
+void multiQueueFree(MultiQueue* mq) {
+    for (int i = 0; i < mq->numQueues; i++) {
+        pthread_mutex_destroy(&mq->queues[i].lock);
+        MinHeap_free(&mq->queues[i].heap);
+    }
+    free(mq->queues);
+}
+
+// Per-thread xorshift generator
+static unsigned int nextRandom(unsigned int* state) {
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void refreshTop(LockedQueue* q) {
+    atomic_store_explicit(&q->top, q->heap.size ? (long long)MinHeap_top(&q->heap) : EMPTY_TOP,
+                          memory_order_relaxed);
+}
+
+void multiQueueInsert(MultiQueue* mq, int value, unsigned int* seed) {
+    while (1) {
+        LockedQueue* q = &mq->queues[nextRandom(seed) % mq->numQueues];
+        if (pthread_mutex_trylock(&q->lock) == 0) {
+            MinHeap_push(&q->heap, value);
+            refreshTop(q);
+            pthread_mutex_unlock(&q->lock);
+            return;
+        }
+    }
+}
+
+// Pops an approximately minimal value; returns 0, or -1 if every queue is empty
+int multiQueueDeleteMin(MultiQueue* mq, int* value, unsigned int* seed) {
+    for (int attempt = 0; attempt < 2 * mq->numQueues; attempt++) {
+        LockedQueue* a = &mq->queues[nextRandom(seed) % mq->numQueues];
+        LockedQueue* b = &mq->queues[nextRandom(seed) % mq->numQueues];
+        long long topA = atomic_load_explicit(&a->top, memory_order_relaxed);
+        long long topB = atomic_load_explicit(&b->top, memory_order_relaxed);
+        LockedQueue* q = topB < topA ? b : a;
+        if ((topA < topB ? topA : topB) == EMPTY_TOP) continue;
+        if (pthread_mutex_trylock(&q->lock) != 0) continue;
+        if (q->heap.size > 0) {
+            *value = MinHeap_pop(&q->heap);
+            refreshTop(q);
+            pthread_mutex_unlock(&q->lock);
+            return 0;
+        }
+        pthread_mutex_unlock(&q->lock);
+    }
+    // Sampling kept missing: sweep every queue before reporting empty
+    for (int i = 0; i < mq->numQueues; i++) {
+        LockedQueue* q = &mq->queues[i];
+        pthread_mutex_lock(&q->lock);
+        if (q->heap.size > 0) {
+            *value = MinHeap_pop(&q->heap);
+            refreshTop(q);
+            pthread_mutex_unlock(&q->lock);
+            return 0;
+        }
+        pthread_mutex_unlock(&q->lock);
+    }
+    return -1;
+}
+
+// --- Benchmark ---
+
+typedef struct {
+    MultiQueue* mq;         // NULL selects the global-lock baseline
+    MinHeap* globalHeap;
+    pthread_mutex_t* globalLock;
+    int ops;
+    unsigned int seed;
+} BenchArg;
+
+void* benchWorker(void* p) {
+    BenchArg* arg = (BenchArg*)p;
+    int value;
+    for (int i = 0; i < arg->ops; i++) {
+        int key = (int)(nextRandom(&arg->seed) >> 1);
+        if (arg->mq) {
+            multiQueueInsert(arg->mq, key, &arg->seed);
+            multiQueueDeleteMin(arg->mq, &value, &arg->seed);
+        } else {
+            pthread_mutex_lock(arg->globalLock);
+            MinHeap_push(arg->globalHeap, key);
+            pthread_mutex_unlock(arg->globalLock);
+            pthread_mutex_lock(arg->globalLock);
+            MinHeap_pop(arg->globalHeap);
+            pthread_mutex_unlock(arg->globalLock);
+        }
+    }
+    return NULL;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Runs ops insert+deleteMin pairs per thread on a prefilled queue; returns Mops/s
+double runTrial(int threads, int queuesPerThread, int ops, int prefill) {
+    MultiQueue mq;
+    MinHeap globalHeap;
+    pthread_mutex_t globalLock;
+    unsigned int seed = 12345;
+    int useMulti = queuesPerThread > 0;
+
+    if (useMulti) {
+        multiQueueInit(&mq, threads, queuesPerThread);
+        for (int i = 0; i < prefill; i++) multiQueueInsert(&mq, (int)(nextRandom(&seed) >> 1), &seed);
+    } else {
+        MinHeap_init(&globalHeap);
+        pthread_mutex_init(&globalLock, NULL);
+        for (int i = 0; i < prefill; i++) MinHeap_push(&globalHeap, (int)(nextRandom(&seed) >> 1));
+    }
+
+    pthread_t* tids = (pthread_t*)malloc(threads * sizeof(pthread_t));
+    BenchArg* args = (BenchArg*)malloc(threads * sizeof(BenchArg));
+    double t = nowSeconds();
+    for (int i = 0; i < threads; i++) {
+        args[i].mq = useMulti ? &mq : NULL;
+        args[i].globalHeap = &globalHeap;
+        args[i].globalLock = &globalLock;
+        args[i].ops = ops;
+        args[i].seed = 2463534242u + 977u * (unsigned int)i;
+        pthread_create(&tids[i], NULL, benchWorker, &args[i]);
+    }
+    for (int i = 0; i < threads; i++) pthread_join(tids[i], NULL);
+    double elapsed = nowSeconds() - t;
+
+    if (useMulti) {
+        multiQueueFree(&mq);
+    } else {
+        MinHeap_free(&globalHeap);
+        pthread_mutex_destroy(&globalLock);
+    }
+    free(tids);
+    free(args);
+    return 2.0 * ops * threads / elapsed / 1e6;
+}
+
+// Global mutex vs MultiQueue throughput for 1, 2, 4, ... maxThreads threads
+void runBenchmark(int maxThreads, int queuesPerThread, int ops) {
+    printf("%8s %16s %16s   (Mops/s)\n", "threads", "global mutex", "MultiQueue");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        double global = runTrial(threads, 0, ops, 1 << 16);
+        double multi = runTrial(threads, queuesPerThread, ops, 1 << 16);
+        printf("%8d %16.2f %16.2f\n", threads, global, multi);
+    }
+}
+
+// Usage: Multi_Queue [bench [max threads] [queues per thread] [ops per thread]]
+int main(int argc, char* argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(argc >= 3 ? atoi(argv[2]) : 32, argc >= 4 ? atoi(argv[3]) : 2,
+                     argc >= 5 ? atoi(argv[4]) : 200000);
+        return 0;
+    }
+
+    // Single-threaded sanity check: pops come out nearly sorted
+    MultiQueue mq;
+    unsigned int seed = 1;
+    multiQueueInit(&mq, 1, 2);
+    int values[] = {42, 7, 19, 3, 88, 25, 61, INT_MAX};
+    for (int i = 0; i < 8; i++) multiQueueInsert(&mq, values[i], &seed);
+    int v;
+    printf("Relaxed pops: ");
+    while (multiQueueDeleteMin(&mq, &v, &seed) == 0) printf("%d ", v);
+    printf("\n");
+    multiQueueFree(&mq);
+    return 0;
+}
@@ -0,0 +1,274 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Heap.h"
+
+#define POOL_BLOCK_NODES 4096
+
+#define LESS(a, b) ((a) < (b))
+DEFINE_HEAP(MinHeap, int, LESS)
+
+// Pairing heap node: leftmost child plus next sibling
+typedef struct PairNode {
+    int key;
+    struct PairNode* child;
+    struct PairNode* sibling; // also links free nodes in the pool
+} PairNode;
+
+// Nodes are carved from blocks and recycled through a free list. Only heaps
+// sharing one pool can be melded; meld refuses the rest.
+typedef struct PoolBlock {
+    struct PoolBlock* next;
+    PairNode nodes[POOL_BLOCK_NODES];
+} PoolBlock;
+
+typedef struct {
+    PoolBlock* blocks;
+    PairNode* freeList;
+} NodePool;
+
+typedef struct {
+    PairNode* root;
+    int size;
+    NodePool* pool;
+} PairingHeap;
+
+// --- Pool ---
+
+void poolInit(NodePool* pool) {
+    pool->blocks = NULL;
+    pool->freeList = NULL;
+}
+
+PairNode* poolAlloc(NodePool* pool) {
+    if (pool->freeList == NULL) {
+        PoolBlock* block = (PoolBlock*)malloc(sizeof(PoolBlock));
+        if (block == NULL) {
+            perror("Memory allocation failed");
+            exit(1);
+        }
+        block->next = pool->blocks;
+        pool->blocks = block;
+        for (int i = POOL_BLOCK_NODES - 1; i >= 0; i--) {
+            block->nodes[i].sibling = pool->freeList;
+            pool->freeList = &block->nodes[i];
+        }
+    }
+    PairNode* node = pool->freeList;
+    pool->freeList = node->sibling;
+    return node;
+}
+
+void poolRelease(NodePool* pool, PairNode* node) {
+    node->sibling = pool->freeList;
+    pool->freeList = node;
+}
+
+// Frees every block at once, and with them every heap using the pool
+void poolDestroy(NodePool* pool) {
+    while (pool->blocks != NULL) {
+        PoolBlock* next = pool->blocks->next;
+        free(pool->blocks);
+        pool->blocks = next;
+    }
+    pool->freeList = NULL;
+}
+
+// --- Pairing heap ---
+
+void initializeHeap(PairingHeap* h, NodePool* pool) {
+    h->root = NULL;
+    h->size = 0;
+    h->pool = pool;
+}
+
+// Links two roots: the larger becomes the first child of the smaller
+static PairNode* link(PairNode* a, PairNode* b) {
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (b->key < a->key) {
+        PairNode* t = a;
+        a = b;
+        b = t;
+    }
+    b->sibling = a->child;
+    a->child = b;
+    return a;
+}
+
+// Two-pass pairing of a sibling list, done iteratively: pair neighbours
+// left to right, then link the pairs right to left
+static PairNode* mergePairs(PairNode* first) {
+    PairNode* pairs = NULL; // stack of linked pairs, most recent first
+    while (first != NULL) {
+        PairNode* a = first;
+        PairNode* b = a->sibling;
+        first = b ? b->sibling : NULL;
+        a->sibling = NULL;
+        if (b) b->sibling = NULL;
+        PairNode* pair = link(a, b);
+        pair->sibling = pairs;
+        pairs = pair;
+    }
+    PairNode* result = NULL;
+    while (pairs != NULL) {
+        PairNode* next = pairs->sibling;
+        pairs->sibling = NULL;
+        result = link(result, pairs);
+        pairs = next;
+    }
+    return result;
+}
+
+// O(1)
+void insert(PairingHeap* h, int key) {
+    PairNode* node = poolAlloc(h->pool);
+    node->key = key;
+    node->child = NULL;
+    node->sibling = NULL;
+    h->root = link(h->root, node);
+    h->size++;
+}
+
+// O(1): moves every element of other into h and leaves other empty.
+// Returns 0, or -1 if the heaps use different pools.
+int meld(PairingHeap* h, PairingHeap* other) {
+    if (h->pool != other->pool) {
+        printf("Cannot meld heaps from different pools.\n");
+        return -1;
+    }
+    h->root = link(h->root, other->root);
+    h->size += other->size;
+    other->root = NULL;
+    other->size = 0;
+    return 0;
+}
+
+int findMin(PairingHeap* h) {
+    if (h->root == NULL) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    return h->root->key;
+}
+
+// Amortized O(log n)
+int deleteMin(PairingHeap* h) {
+    if (h->root == NULL) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    PairNode* old = h->root;
+    int minVal = old->key;
+    h->root = mergePairs(old->child);
+    poolRelease(h->pool, old);
+    h->size--;
+    return minVal;
+}
+
+// --- Benchmark ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Combines numHeaps heaps of heapSize elements into one, both ways
+void runBenchmark(int numHeaps, int heapSize) {
+    if (numHeaps < 1 || heapSize < 0) {
+        printf("Usage: Pairing_Heap bench <heaps >= 1> <elements per heap >= 0>\n");
+        return;
+    }
+    unsigned int seed = 11;
+    NodePool pool;
+    poolInit(&pool);
+    PairingHeap* ph = (PairingHeap*)malloc(numHeaps * sizeof(PairingHeap));
+    MinHeap* ah = (MinHeap*)malloc(numHeaps * sizeof(MinHeap));
+    if (ph == NULL || ah == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (int i = 0; i < numHeaps; i++) {
+        initializeHeap(&ph[i], &pool);
+        MinHeap_init(&ah[i]);
+        for (int j = 0; j < heapSize; j++) {
+            seed = seed * 1103515245u + 12345u;
+            int key = (int)(seed >> 1);
+            insert(&ph[i], key);
+            MinHeap_push(&ah[i], key);
+        }
+    }
+
+    double t = nowSeconds();
+    for (int i = 1; i < numHeaps; i++) {
+        meld(&ph[0], &ph[i]);
+    }
+    printf("Pairing heap meld     : %.6f s\n", nowSeconds() - t);
+
+    t = nowSeconds();
+    for (int i = 1; i < numHeaps; i++) {
+        for (int j = 0; j < ah[i].size; j++) {
+            MinHeap_push(&ah[0], ah[i].items[j]);
+        }
+        MinHeap_free(&ah[i]);
+    }
+    printf("Array heap re-insert  : %.6f s\n", nowSeconds() - t);
+
+    // Spot-check that both hold the same smallest values; the first pop pays
+    // for the deferred pairing work of the melds
+    int checks = ph[0].size < 100000 ? ph[0].size : 100000;
+    int mismatches = 0;
+    t = nowSeconds();
+    for (int i = 0; i < checks; i++) {
+        mismatches += deleteMin(&ph[0]) != MinHeap_pop(&ah[0]);
+    }
+    printf("%d pops from both (%d mismatches): %.3f s\n", checks, mismatches, nowSeconds() - t);
+
+    MinHeap_free(&ah[0]);
+    poolDestroy(&pool);
+    free(ph);
+    free(ah);
+}
+
+// Usage: Pairing_Heap [bench <heaps> <elements per heap>]
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), atoi(argv[3]));
+        return 0;
+    }
+
+    NodePool pool;
+    poolInit(&pool);
+    PairingHeap a, b;
+    initializeHeap(&a, &pool);
+    initializeHeap(&b, &pool);
+
+    insert(&a, 10);
+    insert(&a, 5);
+    insert(&a, 15);
+    insert(&b, 7);
+    insert(&b, 2);
+    insert(&b, 30);
+
+    meld(&a, &b);
+    printf("Melded heap min: %d (size %d)\n", findMin(&a), a.size);
+    printf("Deleted in order: ");
+    while (a.size > 0) {
+        printf("%d ", deleteMin(&a));
+    }
+    printf("\n");
+
+    // A heap on another pool cannot be melded in
+    NodePool otherPool;
+    poolInit(&otherPool);
+    PairingHeap c;
+    initializeHeap(&c, &otherPool);
+    insert(&c, 1);
+    meld(&a, &c);
+
+    poolDestroy(&otherPool);
+    poolDestroy(&pool);
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Heap.h"
+
+#define NUM_BUCKETS 33
+
+#define LESS(a, b) ((a) < (b))
+DEFINE_HEAP(MinHeap, int, LESS)
+
+// Radix heap for monotone non-negative int keys: every inserted key must
+// be >= the last key deleted. Bucket 0 holds keys equal to last; bucket
+// i > 0 holds keys whose highest bit differing from last is bit i - 1.
+// deleteMin only rescans a bucket when bucket 0 is empty, and each key
+// moves to strictly lower buckets, so a key is touched at most 33 times.
+typedef struct {
+    int* items;
+    int size;
+    int capacity;
+} Bucket;
+
+typedef struct {
+    Bucket buckets[NUM_BUCKETS];
+    unsigned int last;
+    int size;
+} RadixHeap;
+
+// Initializes the heap
+void initializeHeap(RadixHeap* h) {
+    memset(h, 0, sizeof(*h));
+}
+
+void freeHeap(RadixHeap* h) {
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        free(h->buckets[i].items);
+    }
+    initializeHeap(h);
+}
+
+// Bucket for key relative to the last extracted key: the bit length of
+// the highest bit where they differ
+static int bucketOf(unsigned int key, unsigned int last) {
+    unsigned int diff = key ^ last;
+#if defined(__GNUC__) || defined(__clang__)
+    return diff == 0 ? 0 : 32 - __builtin_clz(diff);
+#else
+    int bits = 0;
+    while (diff) {
+        diff >>= 1;
+        bits++;
+    }
+    return bits;
+#endif
+}
+
+static void bucketPush(Bucket* b, int value) {
+    heapReserve((void**)&b->items, &b->capacity, b->size + 1, sizeof(int));
+    b->items[b->size++] = value;
+}
+
+// Inserts an element; rejects keys that would break monotonicity
+void insert(RadixHeap* h, int value) {
+    if (value < 0 || (unsigned int)value < h->last) {
+        printf("Key %d is below the last deleted minimum %u.\n", value, h->last);
+        return;
+    }
+    bucketPush(&h->buckets[bucketOf((unsigned int)value, h->last)], value);
+    h->size++;
+}
+
+// Deletes the minimum element
+int deleteMin(RadixHeap* h) {
+    if (h->size <= 0) {
+        printf("Heap is empty.\n");
+        return -1;
+    }
+    if (h->buckets[0].size == 0) {
+        // Lowest non-empty bucket holds the new minimum; redistribute it
+        int i = 1;
+        while (h->buckets[i].size == 0) {
+            i++;
+        }
+        Bucket* b = &h->buckets[i];
+        int minVal = b->items[0];
+        for (int j = 1; j < b->size; j++) {
+            if (b->items[j] < minVal) minVal = b->items[j];
+        }
+        h->last = (unsigned int)minVal;
+        for (int j = 0; j < b->size; j++) {
+            bucketPush(&h->buckets[bucketOf((unsigned int)b->items[j], h->last)], b->items[j]);
+        }
+        b->size = 0;
+    }
+    h->size--;
+    return h->buckets[0].items[--h->buckets[0].size];
+}
+
+// Prints heap elements (bucket order, not sorted)
+void printHeap(RadixHeap* h) {
+    printf("Radix heap elements: ");
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        for (int j = 0; j < h->buckets[i].size; j++) {
+            printf("%d ", h->buckets[i].items[j]);
+        }
+    }
+    printf("\n");
+}
+
+// --- Benchmark ---
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Dijkstra-like workload: each pop of key m pushes a few keys m + w
+void runBenchmark(int initial, int pops) {
+    RadixHeap rh;
+    MinHeap bh;
+    initializeHeap(&rh);
+    MinHeap_init(&bh);
+    unsigned int seed = 5;
+    for (int i = 0; i < initial; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int key = (int)((seed >> 8) % 1000000u);
+        insert(&rh, key);
+        MinHeap_push(&bh, key);
+    }
+
+    long long sumRadix = 0, sumBinary = 0;
+    unsigned int s1 = 9;
+    double t = nowSeconds();
+    for (int i = 0; i < pops && rh.size > 0; i++) {
+        int m = deleteMin(&rh);
+        sumRadix += m;
+        for (int e = 0; e < 3; e++) {
+            s1 = s1 * 1103515245u + 12345u;
+            if ((s1 >> 30) != 0) insert(&rh, m + (int)((s1 >> 8) % 10000u));
+        }
+    }
+    printf("Radix heap  : %.3f s (checksum %lld)\n", nowSeconds() - t, sumRadix);
+
+    unsigned int s2 = 9;
+    t = nowSeconds();
+    for (int i = 0; i < pops && bh.size > 0; i++) {
+        int m = MinHeap_pop(&bh);
+        sumBinary += m;
+        for (int e = 0; e < 3; e++) {
+            s2 = s2 * 1103515245u + 12345u;
+            if ((s2 >> 30) != 0) MinHeap_push(&bh, m + (int)((s2 >> 8) % 10000u));
+        }
+    }
+    printf("Binary heap : %.3f s (checksum %lld)\n", nowSeconds() - t, sumBinary);
+
+    freeHeap(&rh);
+    MinHeap_free(&bh);
+}
+
+// Usage: Radix_Heap [bench <initial keys> <pops>]
+int main(int argc, char* argv[]) {
+    if (argc >= 4 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), atoi(argv[3]));
+        return 0;
+    }
+
+    RadixHeap myHeap;
+    initializeHeap(&myHeap);
+
+    insert(&myHeap, 10);
+    insert(&myHeap, 5);
+    insert(&myHeap, 15);
+    printHeap(&myHeap);
+
+    printf("Deleted min element: %d\n", deleteMin(&myHeap));
+    insert(&myHeap, 7);
+    insert(&myHeap, 3); // rejected: smaller than 5
+    printf("Deleted min element: %d\n", deleteMin(&myHeap));
+    printHeap(&myHeap);
+
+    freeHeap(&myHeap);
+    return 0;
+}
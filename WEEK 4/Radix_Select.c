@@ -0,0 +1,370 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define DIGIT_BITS 16
+#define NUM_BUCKETS (1 << DIGIT_BITS)
+#define DEFAULT_BUDGET (64u << 20) // bytes a candidate bucket may occupy in RAM
+
+// Memory-mapped file of native-endian int32 or int64 values
+typedef struct {
+    const unsigned char* data;
+    size_t length;
+    size_t count;
+    int width; // 4 or 8 bytes
+} KeyFile;
+
+// Work for one thread: a histogram pass or a collection pass over a slice
+typedef struct {
+    const KeyFile* file;
+    size_t from, to;
+    int pass;          // 0 means no prefix filter
+    int prefixShift;   // key >> prefixShift must equal prefix
+    uint64_t prefix;
+    int digitShift;
+    uint64_t* histogram;
+    uint64_t* collected; // collection pass output
+    size_t collectedCount;
+    size_t collectedCapacity;
+} Slice;
+
+// Order-preserving unsigned key: flipping the sign bit sorts negatives first
+static uint64_t keyAt(const KeyFile* f, size_t i) {
+    if (f->width == 4) {
+        int32_t v;
+        memcpy(&v, f->data + i * 4, 4);
+        return (uint32_t)v ^ 0x80000000u;
+    }
+    int64_t v;
+    memcpy(&v, f->data + i * 8, 8);
+    return (uint64_t)v ^ 0x8000000000000000ull;
+}
+
+static int64_t valueOf(uint64_t key, int width) {
+    if (width == 4) {
+        return (int32_t)(uint32_t)(key ^ 0x80000000u);
+    }
+    return (int64_t)(key ^ 0x8000000000000000ull);
+}
+
+static int matchesPrefix(const Slice* s, uint64_t key) {
+    return s->pass == 0 || (key >> s->prefixShift) == s->prefix;
+}
+
+void* histogramWorker(void* arg) {
+    Slice* s = (Slice*)arg;
+    memset(s->histogram, 0, NUM_BUCKETS * sizeof(uint64_t));
+    for (size_t i = s->from; i < s->to; i++) {
+        uint64_t key = keyAt(s->file, i);
+        if (matchesPrefix(s, key)) {
+            s->histogram[(key >> s->digitShift) & (NUM_BUCKETS - 1)]++;
+        }
+    }
+    return NULL;
+}
+
+void* collectWorker(void* arg) {
+    Slice* s = (Slice*)arg;
+    s->collectedCount = 0;
+    for (size_t i = s->from; i < s->to; i++) {
+        uint64_t key = keyAt(s->file, i);
+        if (matchesPrefix(s, key)) {
+            if (s->collectedCount == s->collectedCapacity) {
+                s->collectedCapacity = s->collectedCapacity ? s->collectedCapacity * 2 : 1024;
+                s->collected = (uint64_t*)realloc(s->collected,
+                                                  s->collectedCapacity * sizeof(uint64_t));
+                if (s->collected == NULL) {
+                    perror("Memory allocation failed");
+                    exit(1);
+                }
+            }
+            s->collected[s->collectedCount++] = key;
+        }
+    }
+    return NULL;
+}
+
+// Runs worker on every slice, one thread per slice
+void runSlices(Slice* slices, int numThreads, void* (*worker)(void*)) {
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    for (int t = 1; t < numThreads; t++) {
+        pthread_create(&threads[t], NULL, worker, &slices[t]);
+    }
+    worker(&slices[0]);
+    for (int t = 1; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+}
+
+// Quickselect on the in-memory candidate keys
+uint64_t selectKeys(uint64_t* a, size_t n, size_t rank) {
+    size_t lo = 0, hi = n - 1;
+    while (lo < hi) {
+        uint64_t x = a[lo], y = a[lo + (hi - lo) / 2], z = a[hi];
+        uint64_t pivot = x < y ? (y < z ? y : (x < z ? z : x)) : (x < z ? x : (y < z ? z : y));
+        size_t i = lo, j = hi;
+        while (i <= j) {
+            while (a[i] < pivot) i++;
+            while (a[j] > pivot) j--;
+            if (i <= j) {
+                uint64_t tmp = a[i];
+                a[i] = a[j];
+                a[j] = tmp;
+                i++;
+                if (j == 0) break;
+                j--;
+            }
+        }
+        if (rank <= j) {
+            hi = j;
+        } else if (rank >= i) {
+            lo = i;
+        } else {
+            break;
+        }
+    }
+    return a[rank];
+}
+
+int openKeyFile(KeyFile* f, const char* path, int width) {
+    if (width != 4 && width != 8) {
+        printf("Key width must be 32 or 64 bits.\n");
+        return -1;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror("Cannot open file");
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0 || st.st_size % width != 0) {
+        printf("%s is empty or not a whole number of %d-byte values.\n", path, width);
+        close(fd);
+        return -1;
+    }
+    f->length = (size_t)st.st_size;
+    f->count = f->length / width;
+    f->width = width;
+    f->data = (const unsigned char*)mmap(NULL, f->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (f->data == MAP_FAILED) {
+        perror("mmap failed");
+        return -1;
+    }
+    // Histogram passes stream the file front to back
+    posix_madvise((void*)f->data, f->length, POSIX_MADV_SEQUENTIAL);
+    return 0;
+}
+
+void closeKeyFile(KeyFile* f) {
+    munmap((void*)f->data, f->length);
+}
+
+// Finds the kth smallest (1-based) value of the file. Each pass histograms
+// the next 16 bits of the keys that share the prefix found so far, then
+// narrows to the bucket holding rank k. Once that bucket fits in budget
+// bytes it is copied to RAM and finished with quickselect.
+// Returns 0, or -1 for an invalid k.
+int radixSelect(const KeyFile* f, size_t k, int numThreads, size_t budget, int64_t* result) {
+    if (k < 1 || k > f->count) {
+        return -1;
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    int bits = f->width * 8;
+    uint64_t rank = k - 1;
+    uint64_t prefix = 0;
+    uint64_t candidates = f->count;
+
+    Slice* slices = (Slice*)calloc(numThreads, sizeof(Slice));
+    uint64_t* total = (uint64_t*)malloc(NUM_BUCKETS * sizeof(uint64_t));
+    for (int t = 0; t < numThreads; t++) {
+        slices[t].file = f;
+        slices[t].from = f->count * t / numThreads;
+        slices[t].to = f->count * (t + 1) / numThreads;
+        slices[t].histogram = (uint64_t*)malloc(NUM_BUCKETS * sizeof(uint64_t));
+    }
+
+    int found = 0;
+    for (int pass = 0; pass * DIGIT_BITS < bits; pass++) {
+        int prefixShift = bits - pass * DIGIT_BITS;
+        int digitShift = prefixShift - DIGIT_BITS;
+
+        if (pass > 0 && candidates * sizeof(uint64_t) <= budget) {
+            // Materialize the remaining candidates
+            for (int t = 0; t < numThreads; t++) {
+                slices[t].pass = pass;
+                slices[t].prefixShift = prefixShift;
+                slices[t].prefix = prefix;
+            }
+            runSlices(slices, numThreads, collectWorker);
+            uint64_t* keys = (uint64_t*)malloc(candidates * sizeof(uint64_t));
+            size_t n = 0;
+            for (int t = 0; t < numThreads; t++) {
+                if (slices[t].collectedCount > 0) {
+                    memcpy(keys + n, slices[t].collected, slices[t].collectedCount * sizeof(uint64_t));
+                }
+                n += slices[t].collectedCount;
+            }
+            *result = valueOf(selectKeys(keys, n, rank), f->width);
+            free(keys);
+            found = 1;
+            break;
+        }
+
+        for (int t = 0; t < numThreads; t++) {
+            slices[t].pass = pass;
+            slices[t].prefixShift = prefixShift;
+            slices[t].prefix = prefix;
+            slices[t].digitShift = digitShift;
+        }
+        runSlices(slices, numThreads, histogramWorker);
+
+        memset(total, 0, NUM_BUCKETS * sizeof(uint64_t));
+        for (int t = 0; t < numThreads; t++) {
+            for (int b = 0; b < NUM_BUCKETS; b++) {
+                total[b] += slices[t].histogram[b];
+            }
+        }
+        int bucket = 0;
+        while (rank >= total[bucket]) {
+            rank -= total[bucket];
+            bucket++;
+        }
+        prefix = (prefix << DIGIT_BITS) | (uint64_t)bucket;
+        candidates = total[bucket];
+    }
+    if (!found) {
+        // Every bit is fixed: the prefix is the key itself
+        *result = valueOf(prefix, f->width);
+    }
+
+    for (int t = 0; t < numThreads; t++) {
+        free(slices[t].histogram);
+        free(slices[t].collected);
+    }
+    free(slices);
+    free(total);
+    return 0;
+}
+
+// --- Test data and benchmark ---
+
+int generateFile(const char* path, size_t count, int width) {
+    if (width != 4 && width != 8) {
+        printf("Key width must be 32 or 64 bits.\n");
+        return -1;
+    }
+    FILE* out = fopen(path, "wb");
+    if (out == NULL) {
+        perror("Cannot create file");
+        return -1;
+    }
+    uint64_t state = 88172645463325252ull;
+    unsigned char block[1 << 16];
+    size_t perBlock = sizeof(block) / width;
+    for (size_t done = 0; done < count; ) {
+        size_t n = count - done < perBlock ? count - done : perBlock;
+        for (size_t i = 0; i < n; i++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            if (width == 4) {
+                int32_t v = (int32_t)state;
+                memcpy(block + i * 4, &v, 4);
+            } else {
+                int64_t v = (int64_t)state;
+                memcpy(block + i * 8, &v, 8);
+            }
+        }
+        if (fwrite(block, width, n, out) != n) {
+            perror("Write failed");
+            fclose(out);
+            return -1;
+        }
+        done += n;
+    }
+    return fclose(out) == 0 ? 0 : -1;
+}
+
+int compareInt64(const void* a, const void* b) {
+    int64_t x = *(const int64_t*)a, y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Usage:
+//   Radix_Select gen <file> <count> <32|64>
+//   Radix_Select <file> <32|64> <k> [threads]
+//   Radix_Select                       (small self-check)
+int main(int argc, char* argv[]) {
+    if (argc == 5 && strcmp(argv[1], "gen") == 0) {
+        return generateFile(argv[2], strtoull(argv[3], NULL, 10), atoi(argv[4]) / 8) ? 1 : 0;
+    }
+
+    if (argc >= 4) {
+        KeyFile f;
+        int threads = argc >= 5 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        if (openKeyFile(&f, argv[1], atoi(argv[2]) / 8) != 0) {
+            return 1;
+        }
+        int64_t value;
+        double t = nowSeconds();
+        if (radixSelect(&f, strtoull(argv[3], NULL, 10), threads, DEFAULT_BUDGET, &value) != 0) {
+            printf("Invalid value of K.\n");
+            closeKeyFile(&f);
+            return 1;
+        }
+        double elapsed = nowSeconds() - t;
+        printf("The %sth smallest element is: %lld\n", argv[3], (long long)value);
+        printf("%.3f s, %.1f MB/s with %d thread(s)\n", elapsed, f.length / elapsed / 1e6, threads);
+        closeKeyFile(&f);
+        return 0;
+    }
+
+    // Self-check against sorting on a small generated file
+    const char* path = "radix_demo.bin";
+    size_t count = 1000000;
+    for (int width = 4; width <= 8; width += 4) {
+        if (generateFile(path, count, width) != 0) {
+            return 1;
+        }
+        KeyFile f;
+        if (openKeyFile(&f, path, width) != 0) {
+            return 1;
+        }
+        int64_t* sorted = (int64_t*)malloc(count * sizeof(int64_t));
+        for (size_t i = 0; i < count; i++) {
+            sorted[i] = valueOf(keyAt(&f, i), width);
+        }
+        qsort(sorted, count, sizeof(int64_t), compareInt64);
+
+        size_t ks[] = {1, count / 100, count / 2, count};
+        for (int i = 0; i < 4; i++) {
+            int64_t value;
+            // A tiny budget forces all histogram passes; the default materializes early
+            radixSelect(&f, ks[i], 4, i % 2 ? DEFAULT_BUDGET : 0, &value);
+            printf("int%d k=%zu: %lld %s\n", width * 8, ks[i], (long long)value,
+                   value == sorted[ks[i] - 1] ? "(matches sort)" : "(MISMATCH)");
+        }
+        free(sorted);
+        closeKeyFile(&f);
+    }
+    remove(path);
+    return 0;
+}
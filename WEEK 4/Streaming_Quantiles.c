@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define KLL_MIN_CAPACITY 2
+
+// Swaps two integers
+void swap(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+int compare(const void *a, const void *b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// ===================== Exact streaming top-k =====================
+
+// Keeps the k smallest (or largest) values seen so far. The heap root is
+// the worst value kept, so a new value either fails one comparison or
+// replaces the root with a single sift-down.
+typedef struct {
+    int* items;
+    int size;
+    int k;
+    int keepLargest; // 0: k smallest (max-heap), 1: k largest (min-heap)
+} TopK;
+
+// True when a should sit above b in the heap
+static int heapAbove(const TopK* t, int a, int b) {
+    return t->keepLargest ? a < b : a > b;
+}
+
+void topKInit(TopK* t, int k, int keepLargest) {
+    t->items = (int*)malloc((size_t)(k > 0 ? k : 1) * sizeof(int));
+    if (t->items == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    t->size = 0;
+    t->k = k;
+    t->keepLargest = keepLargest;
+}
+
+void topKFree(TopK* t) {
+    free(t->items);
+    t->items = NULL;
+}
+
+static void topKSiftDown(TopK* t, int index) {
+    int value = t->items[index];
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= t->size) break;
+        if (child + 1 < t->size && heapAbove(t, t->items[child + 1], t->items[child])) {
+            child++;
+        }
+        if (!heapAbove(t, t->items[child], value)) break;
+        t->items[index] = t->items[child];
+        index = child;
+    }
+    t->items[index] = value;
+}
+
+void topKOffer(TopK* t, int value) {
+    if (t->size < t->k) {
+        int index = t->size++;
+        while (index > 0 && heapAbove(t, value, t->items[(index - 1) / 2])) {
+            t->items[index] = t->items[(index - 1) / 2];
+            index = (index - 1) / 2;
+        }
+        t->items[index] = value;
+    } else if (t->k > 0 && heapAbove(t, t->items[0], value)) {
+        // Replace-top: the new value is better than the worst one kept
+        t->items[0] = value;
+        topKSiftDown(t, 0);
+    }
+}
+
+// Copies the kept values to out, best first; returns how many
+int topKResult(const TopK* t, int* out) {
+    memcpy(out, t->items, (size_t)t->size * sizeof(int));
+    qsort(out, t->size, sizeof(int), compare);
+    if (t->keepLargest) {
+        for (int i = 0, j = t->size - 1; i < j; i++, j--) {
+            swap(&out[i], &out[j]);
+        }
+    }
+    return t->size;
+}
+
+// Folds another top-k of the same kind into t
+void topKMerge(TopK* t, const TopK* other) {
+    for (int i = 0; i < other->size; i++) {
+        topKOffer(t, other->items[i]);
+    }
+}
+
+// ===================== KLL quantile sketch =====================
+
+// Level h holds items of weight 2^h. Lower levels get geometrically less
+// space (factor 2/3); when the sketch is over capacity the lowest full
+// level is sorted and every other item, from a random offset, moves up a
+// level with doubled weight. Normalized rank error is about 3.3 / k.
+typedef struct {
+    int* items;
+    int size;
+    int capacity;
+} Compactor;
+
+typedef struct {
+    int k;
+    uint64_t n; // number of values seen
+    Compactor* levels;
+    int numLevels;
+    uint64_t seed;
+} KLLSketch;
+
+static void compactorPush(Compactor* c, int value) {
+    if (c->size == c->capacity) {
+        c->capacity = c->capacity ? c->capacity * 2 : 8;
+        c->items = (int*)realloc(c->items, (size_t)c->capacity * sizeof(int));
+        if (c->items == NULL) {
+            perror("Memory allocation failed");
+            exit(1);
+        }
+    }
+    c->items[c->size++] = value;
+}
+
+static void kllAddLevel(KLLSketch* s) {
+    s->levels = (Compactor*)realloc(s->levels, (size_t)(s->numLevels + 1) * sizeof(Compactor));
+    if (s->levels == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    memset(&s->levels[s->numLevels], 0, sizeof(Compactor));
+    s->numLevels++;
+}
+
+void kllInit(KLLSketch* s, int k) {
+    s->k = k < 8 ? 8 : k;
+    s->n = 0;
+    s->levels = NULL;
+    s->numLevels = 0;
+    s->seed = 0x9E3779B97F4A7C15ull;
+    kllAddLevel(s);
+}
+
+// Picks k for a target normalized rank error such as 0.01
+void kllInitForError(KLLSketch* s, double epsilon) {
+    double q = 3.3 / epsilon;
+    int k = (int)q;
+    kllInit(s, k < q ? k + 1 : k);
+}
+
+void kllFree(KLLSketch* s) {
+    for (int h = 0; h < s->numLevels; h++) {
+        free(s->levels[h].items);
+    }
+    free(s->levels);
+    s->levels = NULL;
+    s->numLevels = 0;
+}
+
+// Space allowed at level h
+static int kllLevelCapacity(const KLLSketch* s, int h) {
+    int depth = s->numLevels - 1 - h;
+    // ceil(k * (2/3)^depth) as an exact fraction; stop once it is below the floor
+    unsigned long long num = (unsigned long long)s->k, den = 1;
+    for (int d = 0; d < depth && num >= (unsigned long long)KLL_MIN_CAPACITY * den; d++) {
+        num *= 2;
+        den *= 3;
+    }
+    int cap = (int)((num + den - 1) / den);
+    return cap < KLL_MIN_CAPACITY ? KLL_MIN_CAPACITY : cap;
+}
+
+static int kllTotalCapacity(const KLLSketch* s) {
+    int total = 0;
+    for (int h = 0; h < s->numLevels; h++) {
+        total += kllLevelCapacity(s, h);
+    }
+    return total;
+}
+
+static int kllRetained(const KLLSketch* s) {
+    int total = 0;
+    for (int h = 0; h < s->numLevels; h++) {
+        total += s->levels[h].size;
+    }
+    return total;
+}
+
+static void kllCompact(KLLSketch* s) {
+    while (kllRetained(s) > kllTotalCapacity(s)) {
+        int h = 0;
+        while (s->levels[h].size < kllLevelCapacity(s, h)) {
+            h++;
+        }
+        if (h + 1 == s->numLevels) {
+            kllAddLevel(s);
+        }
+        Compactor* c = &s->levels[h];
+        qsort(c->items, c->size, sizeof(int), compare);
+
+        // An odd item out stays behind so total weight is preserved
+        int keep = c->size % 2;
+        int leftover = keep ? c->items[c->size - 1] : 0;
+        s->seed ^= s->seed << 13;
+        s->seed ^= s->seed >> 7;
+        s->seed ^= s->seed << 17;
+        int offset = (int)(s->seed & 1);
+        for (int i = offset; i < c->size - keep; i += 2) {
+            compactorPush(&s->levels[h + 1], c->items[i]);
+        }
+        c = &s->levels[h];
+        c->size = 0;
+        if (keep) {
+            c->items[c->size++] = leftover;
+        }
+    }
+}
+
+void kllUpdate(KLLSketch* s, int value) {
+    compactorPush(&s->levels[0], value);
+    s->n++;
+    if (s->levels[0].size >= kllLevelCapacity(s, 0)) {
+        kllCompact(s);
+    }
+}
+
+// Merges other into s: levels are concatenated, then compacted as needed
+void kllMerge(KLLSketch* s, const KLLSketch* other) {
+    while (s->numLevels < other->numLevels) {
+        kllAddLevel(s);
+    }
+    for (int h = 0; h < other->numLevels; h++) {
+        for (int i = 0; i < other->levels[h].size; i++) {
+            compactorPush(&s->levels[h], other->levels[h].items[i]);
+        }
+    }
+    s->n += other->n;
+    kllCompact(s);
+}
+
+typedef struct {
+    int value;
+    uint64_t weight;
+} WeightedItem;
+
+static int compareWeighted(const void* a, const void* b) {
+    int x = ((const WeightedItem*)a)->value;
+    int y = ((const WeightedItem*)b)->value;
+    return (x > y) - (x < y);
+}
+
+// Approximate q-quantile, 0 <= q <= 1; returns 0 on an empty sketch
+int kllQuantile(const KLLSketch* s, double q) {
+    int m = kllRetained(s);
+    if (m == 0) {
+        return 0;
+    }
+    WeightedItem* all = (WeightedItem*)malloc((size_t)m * sizeof(WeightedItem));
+    int count = 0;
+    for (int h = 0; h < s->numLevels; h++) {
+        for (int i = 0; i < s->levels[h].size; i++) {
+            all[count].value = s->levels[h].items[i];
+            all[count].weight = 1ull << h;
+            count++;
+        }
+    }
+    qsort(all, count, sizeof(WeightedItem), compareWeighted);
+
+    double target = q * (double)s->n;
+    uint64_t cumulative = 0;
+    int result = all[count - 1].value;
+    for (int i = 0; i < count; i++) {
+        cumulative += all[i].weight;
+        if ((double)cumulative >= target) {
+            result = all[i].value;
+            break;
+        }
+    }
+    free(all);
+    return result;
+}
+
+// ===================== Demo =====================
+
+int main() {
+    const int n = 1000000;
+    const int shards = 4;
+    int* data = (int*)malloc(n * sizeof(int));
+    uint32_t state = 2463534242u;
+    for (int i = 0; i < n; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        data[i] = (int)(state % 10000000u);
+    }
+
+    // Exact top-5 from four shards, merged
+    TopK smallest, largest, shardTop;
+    topKInit(&smallest, 5, 0);
+    topKInit(&largest, 5, 1);
+    for (int sh = 0; sh < shards; sh++) {
+        topKInit(&shardTop, 5, 0);
+        for (int i = sh; i < n; i += shards) {
+            topKOffer(&shardTop, data[i]);
+            topKOffer(&largest, data[i]);
+        }
+        topKMerge(&smallest, &shardTop);
+        topKFree(&shardTop);
+    }
+    int out[5];
+    int count = topKResult(&smallest, out);
+    printf("5 smallest:");
+    for (int i = 0; i < count; i++) printf(" %d", out[i]);
+    count = topKResult(&largest, out);
+    printf("\n5 largest:");
+    for (int i = 0; i < count; i++) printf(" %d", out[i]);
+    printf("\n");
+
+    // Approximate quantiles: one sketch per shard, merged
+    KLLSketch merged, shard;
+    kllInitForError(&merged, 0.01);
+    for (int sh = 0; sh < shards; sh++) {
+        kllInitForError(&shard, 0.01);
+        for (int i = sh; i < n; i += shards) {
+            kllUpdate(&shard, data[i]);
+        }
+        kllMerge(&merged, &shard);
+        kllFree(&shard);
+    }
+
+    qsort(data, n, sizeof(int), compare);
+    double qs[] = {0.01, 0.05, 0.5, 0.95, 0.99};
+    printf("Sketch k=%d keeps %d of %d values\n", merged.k, kllRetained(&merged), n);
+    for (int i = 0; i < 5; i++) {
+        int estimate = kllQuantile(&merged, qs[i]);
+        int exact = data[(int)(qs[i] * (n - 1))];
+        printf("q=%.2f estimate %d exact %d\n", qs[i], estimate, exact);
+    }
+
+    kllFree(&merged);
+    topKFree(&smallest);
+    topKFree(&largest);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "Heap.h"
+
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_LEVELS 4 // the wheel covers deadlines within 2^24 ticks
+
+enum { TIMER_FREE, TIMER_IN_WHEEL, TIMER_IN_HEAP };
+
+// Far-future timer parked in the fallback heap. Cancelling such a timer
+// only bumps its generation, so stale entries are skipped when popped.
+typedef struct {
+    uint64_t deadline;
+    int timer;
+    unsigned int generation;
+} HeapEntry;
+
+#define EARLIER(a, b) ((a).deadline < (b).deadline)
+DEFINE_HEAP(TimerHeap, HeapEntry, EARLIER)
+
+// Hierarchical timing wheel. A timer sits on the level of the highest
+// 6-bit digit in which its deadline differs from now, in the slot named by
+// the deadline's digit on that level. When now reaches that slot the
+// timer is re-filed one or more levels lower, and level 0 slots hold
+// exactly the timers due on that tick. Timers beyond the wheel's range
+// wait in a TimerHeap until they come within range.
+typedef struct {
+    uint64_t now;
+    int heads[WHEEL_LEVELS][WHEEL_SLOTS]; // doubly linked lists of timers, -1 = empty
+    uint64_t* deadlines;
+    int* prev;
+    int* next;
+    int* slotOf;           // level * WHEEL_SLOTS + slot while in the wheel
+    unsigned char* state;
+    unsigned int* generation;
+    int* freeList;
+    int freeCount;
+    int count;             // timers ever allocated
+    int capacity;
+    TimerHeap farFuture;
+} TimerWheel;
+
+// A timer's slot index plus the generation it was scheduled in. Slots are
+// recycled, so a handle outliving its timer no longer matches.
+typedef struct {
+    int index;
+    unsigned int generation;
+} TimerHandle;
+
+typedef void (*ExpireFn)(TimerHandle timer, void* context);
+
+void wheelInit(TimerWheel* w) {
+    memset(w, 0, sizeof(*w));
+    memset(w->heads, -1, sizeof(w->heads));
+    TimerHeap_init(&w->farFuture);
+}
+
+void wheelFree(TimerWheel* w) {
+    free(w->deadlines);
+    free(w->prev);
+    free(w->next);
+    free(w->slotOf);
+    free(w->state);
+    free(w->generation);
+    free(w->freeList);
+    TimerHeap_free(&w->farFuture);
+}
+
+static void growTimers(TimerWheel* w) {
+    int capacity = w->capacity ? w->capacity * 2 : 1024;
+    w->deadlines = (uint64_t*)realloc(w->deadlines, capacity * sizeof(uint64_t));
+    w->prev = (int*)realloc(w->prev, capacity * sizeof(int));
+    w->next = (int*)realloc(w->next, capacity * sizeof(int));
+    w->slotOf = (int*)realloc(w->slotOf, capacity * sizeof(int));
+    w->state = (unsigned char*)realloc(w->state, capacity);
+    w->generation = (unsigned int*)realloc(w->generation, capacity * sizeof(unsigned int));
+    w->freeList = (int*)realloc(w->freeList, capacity * sizeof(int));
+    if (!w->deadlines || !w->prev || !w->next || !w->slotOf || !w->state || !w->generation
+        || !w->freeList) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    w->capacity = capacity;
+}
+
+static void linkTimer(TimerWheel* w, int t, int level, int slot) {
+    int* head = &w->heads[level][slot];
+    w->prev[t] = -1;
+    w->next[t] = *head;
+    if (*head != -1) w->prev[*head] = t;
+    *head = t;
+    w->slotOf[t] = level * WHEEL_SLOTS + slot;
+    w->state[t] = TIMER_IN_WHEEL;
+}
+
+static void unlinkTimer(TimerWheel* w, int t) {
+    int level = w->slotOf[t] / WHEEL_SLOTS, slot = w->slotOf[t] % WHEEL_SLOTS;
+    if (w->prev[t] != -1) w->next[w->prev[t]] = w->next[t];
+    else w->heads[level][slot] = w->next[t];
+    if (w->next[t] != -1) w->prev[w->next[t]] = w->prev[t];
+}
+
+// Files timer t by its deadline relative to now. Only cascades reach the
+// deadline == now case, before this tick's level 0 slot is fired.
+static void place(TimerWheel* w, int t) {
+    uint64_t deadline = w->deadlines[t];
+    if (deadline <= w->now) {
+        linkTimer(w, t, 0, (int)(w->now & (WHEEL_SLOTS - 1)));
+        return;
+    }
+    uint64_t diff = deadline ^ w->now;
+    int level = (63 - __builtin_clzll(diff)) / WHEEL_BITS;
+    if (level >= WHEEL_LEVELS) {
+        HeapEntry e = {deadline, t, w->generation[t]};
+        TimerHeap_push(&w->farFuture, e);
+        w->state[t] = TIMER_IN_HEAP;
+        return;
+    }
+    linkTimer(w, t, level, (int)((deadline >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1)));
+}
+
+// O(1) (O(log n) for far-future timers). The current tick has already
+// fired, so a deadline that is now or past fires on the next tick.
+TimerHandle scheduleTimer(TimerWheel* w, uint64_t deadline) {
+    int t;
+    if (w->freeCount > 0) {
+        t = w->freeList[--w->freeCount];
+    } else {
+        if (w->count == w->capacity) growTimers(w);
+        t = w->count++;
+        w->generation[t] = 0;
+    }
+    w->deadlines[t] = deadline > w->now ? deadline : w->now + 1;
+    place(w, t);
+    TimerHandle handle = {t, w->generation[t]};
+    return handle;
+}
+
+static void releaseTimer(TimerWheel* w, int t) {
+    w->state[t] = TIMER_FREE;
+    w->generation[t]++;
+    w->freeList[w->freeCount++] = t;
+}
+
+// O(1); returns 0, or -1 if the timer is not pending
+int cancelTimer(TimerWheel* w, TimerHandle handle) {
+    int t = handle.index;
+    if (t < 0 || t >= w->count || w->state[t] == TIMER_FREE
+        || w->generation[t] != handle.generation) {
+        return -1;
+    }
+    if (w->state[t] == TIMER_IN_WHEEL) {
+        unlinkTimer(w, t);
+    }
+    releaseTimer(w, t);
+    return 0;
+}
+
+// Re-files every timer of one slot
+static void cascade(TimerWheel* w, int level, int slot) {
+    int t = w->heads[level][slot];
+    w->heads[level][slot] = -1;
+    while (t != -1) {
+        int next = w->next[t];
+        place(w, t);
+        t = next;
+    }
+}
+
+// Advances one tick and fires every timer due at the new time
+static int tick(TimerWheel* w, ExpireFn onExpire, void* context) {
+    w->now++;
+
+    // Higher levels first, so timers they release can cascade further down
+    for (int level = WHEEL_LEVELS - 1; level >= 1; level--) {
+        uint64_t lowMask = ((uint64_t)1 << (level * WHEEL_BITS)) - 1;
+        if ((w->now & lowMask) == 0) {
+            cascade(w, level, (int)((w->now >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1)));
+        }
+    }
+    // Pull far-future timers that are now in range
+    while (w->farFuture.size > 0) {
+        HeapEntry e = TimerHeap_top(&w->farFuture);
+        int stale = w->state[e.timer] != TIMER_IN_HEAP || w->generation[e.timer] != e.generation;
+        if (!stale && ((e.deadline ^ w->now) >> (WHEEL_LEVELS * WHEEL_BITS)) != 0) break;
+        TimerHeap_pop(&w->farFuture);
+        if (!stale) place(w, e.timer);
+    }
+
+    int slot = (int)(w->now & (WHEEL_SLOTS - 1));
+    int t = w->heads[0][slot];
+    w->heads[0][slot] = -1;
+    int fired = 0;
+    while (t != -1) {
+        int next = w->next[t];
+        TimerHandle handle = {t, w->generation[t]};
+        releaseTimer(w, t);
+        onExpire(handle, context);
+        fired++;
+        t = next;
+    }
+    return fired;
+}
+
+// Advances time to target, firing timers in deadline order per tick; returns how many fired
+int advanceTo(TimerWheel* w, uint64_t target, ExpireFn onExpire, void* context) {
+    int fired = 0;
+    while (w->now < target) {
+        fired += tick(w, onExpire, context);
+    }
+    return fired;
+}
+
+// --- Demo and benchmark ---
+
+typedef struct {
+    long long fired;
+} ExpireStats;
+
+void countExpired(TimerHandle timer, void* context) {
+    (void)timer;
+    ((ExpireStats*)context)->fired++;
+}
+
+void printExpired(TimerHandle timer, void* context) {
+    printf("  tick %llu: timer %d fired\n", (unsigned long long)*(uint64_t*)context, timer.index);
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// n timers with timeouts up to maxTimeout ticks; cancelPercent of them are
+// cancelled before firing. One timer is scheduled per tick.
+void runBenchmark(int n, int maxTimeout, int cancelPercent) {
+    if (n < 1 || maxTimeout < 1 || cancelPercent < 0 || cancelPercent > 100) {
+        printf("Usage: Timer_Wheel bench <timers >= 1> <max timeout >= 1> <cancel percent 0-100>\n");
+        return;
+    }
+    unsigned int seed = 77;
+    ExpireStats stats = {0};
+
+    TimerWheel w;
+    wheelInit(&w);
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        TimerHandle handle = scheduleTimer(&w, w.now + 1 + (seed >> 8) % (unsigned int)maxTimeout);
+        if ((int)((seed >> 4) % 100u) < cancelPercent) {
+            cancelTimer(&w, handle);
+        }
+        tick(&w, countExpired, &stats);
+    }
+    advanceTo(&w, w.now + (uint64_t)maxTimeout + 1, countExpired, &stats);
+    printf("Timer wheel : %.3f s, %lld fired\n", nowSeconds() - t, stats.fired);
+    wheelFree(&w);
+
+    // Baseline: every timer lives in the heap; cancel marks it, pop skips it
+    TimerHeap heap;
+    TimerHeap_init(&heap);
+    unsigned char* cancelled = (unsigned char*)calloc(n, 1);
+    if (cancelled == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    long long fired = 0;
+    uint64_t now = 0;
+    seed = 77;
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        HeapEntry e = {now + 1 + (seed >> 8) % (unsigned int)maxTimeout, i, 0};
+        TimerHeap_push(&heap, e);
+        if ((int)((seed >> 4) % 100u) < cancelPercent) {
+            cancelled[i] = 1;
+        }
+        now++;
+        while (heap.size > 0 && TimerHeap_top(&heap).deadline <= now) {
+            HeapEntry top = TimerHeap_pop(&heap);
+            fired += !cancelled[top.timer];
+        }
+    }
+    while (heap.size > 0) {
+        HeapEntry top = TimerHeap_pop(&heap);
+        fired += !cancelled[top.timer];
+    }
+    printf("Heap only   : %.3f s, %lld fired\n", nowSeconds() - t, fired);
+    TimerHeap_free(&heap);
+    free(cancelled);
+}
+
+// Usage: Timer_Wheel [bench <timers> <max timeout> <cancel percent>]
+int main(int argc, char* argv[]) {
+    if (argc >= 5 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), atoi(argv[3]), atoi(argv[4]));
+        return 0;
+    }
+
+    TimerWheel w;
+    wheelInit(&w);
+    TimerHandle a = scheduleTimer(&w, 5);
+    TimerHandle b = scheduleTimer(&w, 70);
+    TimerHandle c = scheduleTimer(&w, 3);
+    TimerHandle d = scheduleTimer(&w, 20000000); // beyond the wheel: kept in the heap
+    scheduleTimer(&w, 4100);
+    cancelTimer(&w, b);
+    printf("Timers %d, %d, %d scheduled; %d cancelled; far timer %d in heap: %s\n",
+           a.index, c.index, d.index, b.index, d.index,
+           w.state[d.index] == TIMER_IN_HEAP ? "yes" : "no");
+
+    // b's slot is reused; the old handle must not cancel the new timer
+    TimerHandle e = scheduleTimer(&w, 8);
+    int staleCancel = cancelTimer(&w, b);
+    printf("Stale handle rejected: %s; timer %d still pending: %s\n", staleCancel == -1 ? "yes" : "no",
+           e.index, w.state[e.index] != TIMER_FREE ? "yes" : "no");
+
+    printf("Advancing to tick 10:\n");
+    int fired = advanceTo(&w, 10, printExpired, &w.now);
+
+    // Deadlines at or before now fire on the very next tick
+    scheduleTimer(&w, 10);
+    scheduleTimer(&w, 5);
+    printf("Scheduled deadlines 10 and 5 at tick 10; advancing to tick 11:\n");
+    int overdue = advanceTo(&w, 11, printExpired, &w.now);
+    printf("%d overdue timers fired on tick 11 (expected 2)\n", overdue);
+    fired += overdue;
+
+    printf("Advancing to tick 20000000:\n");
+    fired += advanceTo(&w, 20000000, printExpired, &w.now);
+    printf("%d timers fired\n", fired);
+    wheelFree(&w);
+    return 0;
+}
@@ -1,47 +1,68 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <limits.h>
+#include "Node_Pool.h"
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 // Node structure
 typedef struct node {
     int data;
+    int size; // nodes in this subtree, including this one
     struct node *left;
     struct node *right;
 } Node;
 
+// Each tree allocates from its own NodePool (see Node_Pool.h), which must
+// hold no other tree's nodes, so freeTree can drop the whole pool at once.
+
 // Creates a new node
-Node* createNode(int data) {
-    Node* newNode = (Node*)malloc(sizeof(Node));
-    if (newNode == NULL) {
-        printf("Memory allocation failed!\n");
-        exit(1);
-    }
+Node* createNode(NodePool* pool, int data) {
+    Node* newNode = (Node*)nodePoolAlloc(pool);
     newNode->data = data;
+    newNode->size = 1;
     newNode->left = newNode->right = NULL;
     return newNode;
 }
 
-// Inserts a node
-Node* insert(Node* root, int data) {
-    if (root == NULL) {
-        return createNode(data);
-    }
-    if (data < root->data) {
-        root->left = insert(root->left, data);
-    } else if (data > root->data) {
-        root->right = insert(root->right, data);
+// Searches for a node
+Node* search(Node* root, int data) {
+    while (root != NULL && root->data != data) {
+        root = data < root->data ? root->left : root->right;
     }
     return root;
 }
 
-// Searches for a node
-Node* search(Node* root, int data) {
-    if (root == NULL || root->data == data) {
-        return root;
+// Number of nodes in a subtree
+int sizeOf(Node* node) {
+    return node == NULL ? 0 : node->size;
+}
+
+// Adds delta to the size of every node on the path from root to data's node
+static void adjustPathSizes(Node* root, int data, int delta) {
+    while (root != NULL && root->data != data) {
+        root->size += delta;
+        root = data < root->data ? root->left : root->right;
     }
-    if (data < root->data) {
-        return search(root->left, data);
+}
+
+// Inserts a node. Iterative, so degenerate (sorted) input cannot overflow the stack.
+Node* insert(NodePool* pool, Node* root, int data) {
+    // Sizes grow on the way down; a duplicate is ignored, so undo them then
+    Node** link = &root;
+    while (*link != NULL) {
+        if (data == (*link)->data) {
+            adjustPathSizes(root, data, -1);
+            return root;
+        }
+        (*link)->size++;
+        link = data < (*link)->data ? &(*link)->left : &(*link)->right;
     }
-    return search(root->right, data);
+    *link = createNode(pool, data);
+    return root;
 }
 
 // Finds the minimum value node in a subtree
@@ -53,51 +74,584 @@ Node* findMin(Node* node) {
     return current;
 }
 
-// Deletes a node
-Node* deleteNode(Node* root, int data) {
-    if (root == NULL) {
+// Deletes a node. Walks down with a pointer to the link that holds the
+// current node, so the node can be spliced out without a parent pointer.
+Node* deleteNode(NodePool* pool, Node* root, int data) {
+    // Every node on the path loses one descendant, unless data is missing
+    Node** link = &root;
+    while (*link != NULL && (*link)->data != data) {
+        (*link)->size--;
+        link = data < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    Node* target = *link;
+    if (target == NULL) {
+        adjustPathSizes(root, data, +1);
         return root;
     }
-    if (data < root->data) {
-        root->left = deleteNode(root->left, data);
-    } else if (data > root->data) {
-        root->right = deleteNode(root->right, data);
+    if (target->left == NULL) {
+        *link = target->right;
+        nodePoolFree(pool, target);
+    } else if (target->right == NULL) {
+        *link = target->left;
+        nodePoolFree(pool, target);
     } else {
-        if (root->left == NULL) {
-            Node* temp = root->right;
-            free(root);
-            return temp;
-        } else if (root->right == NULL) {
-            Node* temp = root->left;
-            free(root);
-            return temp;
+        // Two children: the successor is the leftmost node of the right
+        // subtree. It has no left child, so its right child takes its place.
+        target->size--;
+        Node** successorLink = &target->right;
+        while ((*successorLink)->left != NULL) {
+            (*successorLink)->size--;
+            successorLink = &(*successorLink)->left;
         }
-        Node* temp = findMin(root->right);
-        root->data = temp->data;
-        root->right = deleteNode(root->right, temp->data);
+        Node* successor = *successorLink;
+        target->data = successor->data;
+        *successorLink = successor->right;
+        nodePoolFree(pool, successor);
     }
     return root;
 }
 
-// In-order traversal
+// Returns the node holding the kth smallest key (k starts at 1), or NULL
+Node* selectKth(Node* root, int k) {
+    while (root != NULL) {
+        int leftSize = sizeOf(root->left);
+        if (k <= leftSize) {
+            root = root->left;
+        } else if (k == leftSize + 1) {
+            return root;
+        } else {
+            k -= leftSize + 1;
+            root = root->right;
+        }
+    }
+    return NULL;
+}
+
+// Counts keys below x, or at most x when inclusive is set
+static int countBelow(Node* root, int x, int inclusive) {
+    int count = 0;
+    while (root != NULL) {
+        if (x < root->data || (x == root->data && !inclusive)) {
+            root = root->left;
+        } else {
+            count += sizeOf(root->left) + 1;
+            root = root->right;
+        }
+    }
+    return count;
+}
+
+// Number of keys smaller than x
+int rank(Node* root, int x) {
+    return countBelow(root, x, 0);
+}
+
+// Number of keys in [lo, hi]
+int countRange(Node* root, int lo, int hi) {
+    if (lo > hi) {
+        return 0;
+    }
+    return countBelow(root, hi, 1) - countBelow(root, lo, 0);
+}
+
+// In-order traversal with an explicit stack, so deep trees cannot overflow
+// the call stack and the tree itself is never modified. The depth is at
+// most the node count, so root->size slots are always enough.
 void inorder(Node* root) {
-    if (root != NULL) {
-        inorder(root->left);
-        printf("%d ", root->data);
-        inorder(root->right);
+    int n = sizeOf(root);
+    if (n == 0) {
+        return;
+    }
+    Node** stack = (Node**)malloc(n * sizeof(Node*));
+    if (stack == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    int top = 0;
+    Node* current = root;
+    while (current != NULL || top > 0) {
+        while (current != NULL) {
+            stack[top++] = current;
+            current = current->left;
+        }
+        current = stack[--top];
+        printf("%d ", current->data);
+        current = current->right;
+    }
+    free(stack);
+}
+
+// Frees a whole tree. The pool holds this tree only, so that is one O(1)
+// reset; its slabs stay for reuse until nodePoolDestroy. The malloc build
+// frees node by node, rotating left children up so no stack is needed.
+void freeTree(NodePool* pool, Node* root) {
+#ifdef NODE_POOL_MALLOC
+    while (root != NULL) {
+        if (root->left != NULL) {
+            Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            Node* right = root->right;
+            nodePoolFree(pool, root);
+            root = right;
+        }
+    }
+#else
+    (void)root;
+    nodePoolReset(pool);
+#endif
+}
+
+// --- Versioned tree handle ---
+
+// A root, the pool its nodes live in, and a counter bumped by every change
+// made through treeInsert, treeDelete and treeClear. Snapshots remember the
+// version of the one tree they froze, so writes to other trees leave them valid.
+typedef struct {
+    Node* root;
+    unsigned long long version;
+    NodePool pool;
+} BSTree;
+
+#define BSTREE_INIT { NULL, 0, NODE_POOL_INIT(sizeof(Node)) }
+
+void treeInsert(BSTree* tree, int data) {
+    int before = sizeOf(tree->root);
+    tree->root = insert(&tree->pool, tree->root, data);
+    if (sizeOf(tree->root) != before) {
+        tree->version++;
+    }
+}
+
+void treeDelete(BSTree* tree, int data) {
+    int before = sizeOf(tree->root);
+    tree->root = deleteNode(&tree->pool, tree->root, data);
+    if (sizeOf(tree->root) != before) {
+        tree->version++;
+    }
+}
+
+// Empties the tree in O(1); the pool keeps its slabs for reuse
+void treeClear(BSTree* tree) {
+    freeTree(&tree->pool, tree->root);
+    tree->root = NULL;
+    tree->version++;
+}
+
+// Empties the tree and returns its slabs to the system
+void treeDestroy(BSTree* tree) {
+    treeClear(tree);
+    nodePoolDestroy(&tree->pool);
+}
+
+// --- Read-only snapshot in Eytzinger layout ---
+
+#define BLOCK_KEYS 16 // one cache line of ints per block
+
+// The tree's sorted keys frozen into arrays laid out in BFS order, so a
+// search touches one predictable cache line per level instead of chasing
+// pointers. keys is the binary Eytzinger layout (1-based: the children of
+// k are 2k and 2k+1). The optional block layout packs 16 keys per node of a
+// 17-ary tree and compares a whole block at once with SIMD. nodes map each
+// slot back to its tree node; padding slots map to NULL. A snapshot belongs
+// to one BSTree and is stale once that tree's version moves on.
+typedef struct {
+    const BSTree* tree;
+    int* keys;
+    Node** nodes;
+    int* blockKeys;
+    Node** blockNodes;
+    int n;
+    int blockCount;
+    int withBlocks;
+    int frozen;
+    unsigned long long version; // tree->version when frozen
+} Snapshot;
+
+void initSnapshot(Snapshot* snap, const BSTree* tree, int withBlocks) {
+    memset(snap, 0, sizeof(*snap));
+    snap->tree = tree;
+    snap->withBlocks = withBlocks;
+}
+
+void freeSnapshot(Snapshot* snap) {
+    free(snap->keys);
+    free(snap->nodes);
+    free(snap->blockKeys);
+    free(snap->blockNodes);
+    initSnapshot(snap, snap->tree, snap->withBlocks);
+}
+
+static void* allocAligned(size_t bytes) {
+    bytes = (bytes + 63) & ~(size_t)63;
+    void* p = aligned_alloc(64, bytes > 0 ? bytes : 64);
+    if (p == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    return p;
+}
+
+// Places sorted[*next..] into the Eytzinger subtree rooted at k
+static void fillEytzinger(Snapshot* snap, Node** sorted, int* next, int k) {
+    if (k <= snap->n) {
+        fillEytzinger(snap, sorted, next, 2 * k);
+        snap->nodes[k] = sorted[*next];
+        snap->keys[k] = sorted[*next]->data;
+        (*next)++;
+        fillEytzinger(snap, sorted, next, 2 * k + 1);
+    }
+}
+
+static void fillBlocks(Snapshot* snap, Node** sorted, int* next, int block) {
+    if (block >= snap->blockCount) {
+        return;
+    }
+    for (int i = 0; i < BLOCK_KEYS; i++) {
+        fillBlocks(snap, sorted, next, block * (BLOCK_KEYS + 1) + i + 1);
+        int slot = block * BLOCK_KEYS + i;
+        if (*next < snap->n) {
+            snap->blockNodes[slot] = sorted[*next];
+            snap->blockKeys[slot] = sorted[*next]->data;
+            (*next)++;
+        } else {
+            snap->blockNodes[slot] = NULL;
+            snap->blockKeys[slot] = INT_MAX;
+        }
+    }
+    fillBlocks(snap, sorted, next, block * (BLOCK_KEYS + 1) + BLOCK_KEYS + 1);
+}
+
+// Exports the keys of snap's tree into it. The in-order walk uses an
+// explicit stack sized from the node count, so deep trees need no
+// recursion and the tree is only read, never written.
+void freeze(Snapshot* snap) {
+    Node* root = snap->tree->root;
+    freeSnapshot(snap);
+    int n = sizeOf(root);
+    Node** sorted = (Node**)malloc((n + 1) * sizeof(Node*));
+    Node** stack = (Node**)malloc((n + 1) * sizeof(Node*));
+    if (sorted == NULL || stack == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    int count = 0, top = 0;
+    Node* current = root;
+    while (current != NULL || top > 0) {
+        while (current != NULL) {
+            stack[top++] = current;
+            current = current->left;
+        }
+        current = stack[--top];
+        sorted[count++] = current;
+        current = current->right;
+    }
+    free(stack);
+
+    snap->n = n;
+    snap->keys = (int*)allocAligned((n + 1) * sizeof(int));
+    snap->nodes = (Node**)malloc((n + 1) * sizeof(Node*));
+    if (snap->nodes == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    int next = 0;
+    fillEytzinger(snap, sorted, &next, 1);
+
+    if (snap->withBlocks) {
+        snap->blockCount = (n + BLOCK_KEYS - 1) / BLOCK_KEYS;
+        size_t slots = (size_t)snap->blockCount * BLOCK_KEYS;
+        snap->blockKeys = (int*)allocAligned(slots * sizeof(int));
+        snap->blockNodes = (Node**)malloc((slots > 0 ? slots : 1) * sizeof(Node*));
+        if (snap->blockNodes == NULL) {
+            perror("Memory allocation failed");
+            exit(1);
+        }
+        next = 0;
+        fillBlocks(snap, sorted, &next, 0);
+    }
+    free(sorted);
+    snap->frozen = 1;
+    snap->version = snap->tree->version;
+}
+
+// Branchless descent: each step only picks a child, and the key 4 levels
+// down is prefetched (16 ints = one cache line of descendants).
+Node* eytzingerSearch(const Snapshot* snap, int data) {
+    const int* keys = snap->keys;
+    unsigned int n = (unsigned int)snap->n;
+    unsigned int k = 1;
+    while (k <= n) {
+        __builtin_prefetch(keys + 16 * (size_t)k);
+        k = 2 * k + (keys[k] < data);
+    }
+    // Undo the trailing right turns to reach the lower bound
+    k >>= __builtin_ffs(~k);
+    return (k != 0 && keys[k] == data) ? snap->nodes[k] : NULL;
+}
+
+// Number of keys in a block smaller than data
+static inline int blockRank(const int* block, int data) {
+#if defined(__AVX2__)
+    __m256i x = _mm256_set1_epi32(data);
+    __m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)block));
+    __m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(block + 8)));
+    unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(lo))
+                      | (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+    return __builtin_popcount(mask);
+#elif defined(__SSE2__)
+    __m128i x = _mm_set1_epi32(data);
+    unsigned int mask = 0;
+    for (int i = 0; i < 4; i++) {
+        __m128i less = _mm_cmpgt_epi32(x, _mm_load_si128((const __m128i*)(block + 4 * i)));
+        mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(less)) << (4 * i);
+    }
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (int i = 0; i < BLOCK_KEYS; i++) {
+        count += block[i] < data;
+    }
+    return count;
+#endif
+}
+
+// Search in the 16-key block layout; falls back to eytzingerSearch if it was not built
+Node* blockSearch(const Snapshot* snap, int data) {
+    if (snap->blockKeys == NULL) {
+        return eytzingerSearch(snap, data);
+    }
+    int block = 0, candidate = -1;
+    while (block < snap->blockCount) {
+        int i = blockRank(snap->blockKeys + block * BLOCK_KEYS, data);
+        if (i < BLOCK_KEYS) {
+            candidate = block * BLOCK_KEYS + i;
+        }
+        block = block * (BLOCK_KEYS + 1) + i + 1;
+    }
+    if (candidate >= 0 && snap->blockKeys[candidate] == data) {
+        return snap->blockNodes[candidate];
+    }
+    return NULL;
+}
+
+// Searches through the snapshot, refreezing it first if its tree changed
+Node* snapshotSearch(Snapshot* snap, int data) {
+    if (!snap->frozen || snap->version != snap->tree->version) {
+        freeze(snap);
+    }
+    return snap->withBlocks ? blockSearch(snap, data) : eytzingerSearch(snap, data);
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Inserts n random keys, then churns: each step deletes an old key and
+// inserts a new one. Build with -DNODE_POOL_MALLOC for the malloc baseline.
+void runChurnBenchmark(int n) {
+    int* keys = (int*)malloc(n * sizeof(int));
+    if (keys == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    unsigned int seed = 2024;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        keys[i] = (int)(seed >> 1);
+    }
+
+    NodePool pool = NODE_POOL_INIT(sizeof(Node));
+    Node* root = NULL;
+    double t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        root = insert(&pool, root, keys[i]);
+    }
+    double insertTime = nowSeconds() - t;
+
+    t = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        root = deleteNode(&pool, root, keys[i]);
+        seed = seed * 1103515245u + 12345u;
+        keys[i] = (int)(seed >> 1);
+        root = insert(&pool, root, keys[i]);
+    }
+    double churnTime = nowSeconds() - t;
+    long long live = pool.liveNodes;
+
+    t = nowSeconds();
+    freeTree(&pool, root);
+    double freeTime = nowSeconds() - t;
+
+    printf("%s, %d keys: insert %.3f s, churn %.3f s, free %.6f s (%lld live nodes)\n",
+#ifdef NODE_POOL_MALLOC
+           "malloc",
+#else
+           "pool",
+#endif
+           n, insertTime, churnTime, freeTime, live);
+    nodePoolDestroy(&pool);
+    free(keys);
+}
+
+// Fills keys with 0..n-1 in an order that is bad (or good) for an unbalanced BST
+void fillOrder(int* keys, int n, const char* order) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(order, "descending") == 0) {
+            keys[i] = n - 1 - i;
+        } else if (strcmp(order, "zigzag") == 0) {
+            keys[i] = i % 2 == 0 ? i / 2 : n - 1 - i / 2; // 0, n-1, 1, n-2, ...
+        } else {
+            keys[i] = i;
+        }
+    }
+    if (strcmp(order, "random") == 0) {
+        unsigned int seed = 7;
+        for (int i = n - 1; i > 0; i--) {
+            seed = seed * 1103515245u + 12345u;
+            int j = (int)((seed >> 8) % (unsigned int)(i + 1));
+            int temp = keys[i];
+            keys[i] = keys[j];
+            keys[j] = temp;
+        }
+    }
+}
+
+// Inserts, searches and deletes n keys in adversarial orders. Sorted input
+// builds a path of depth n: every operation is O(n), but nothing recurses.
+void runAdversarialBenchmark(int n) {
+    const char* orders[] = {"ascending", "descending", "zigzag", "random"};
+    int* keys = (int*)malloc(n * sizeof(int));
+    if (keys == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    NodePool pool = NODE_POOL_INIT(sizeof(Node));
+    for (int o = 0; o < 4; o++) {
+        fillOrder(keys, n, orders[o]);
+        Node* root = NULL;
+        double t = nowSeconds();
+        for (int i = 0; i < n; i++) {
+            root = insert(&pool, root, keys[i]);
+        }
+        double insertTime = nowSeconds() - t;
+
+        int found = 0;
+        t = nowSeconds();
+        for (int i = 0; i < n; i++) {
+            found += search(root, i) != NULL;
+        }
+        double searchTime = nowSeconds() - t;
+
+        t = nowSeconds();
+        for (int i = 0; i < n; i++) {
+            root = deleteNode(&pool, root, keys[n - 1 - i]);
+        }
+        double deleteTime = nowSeconds() - t;
+
+        printf("%-10s %d keys: insert %.3f s, search %.3f s (%d found), delete %.3f s%s\n",
+               orders[o], n, insertTime, searchTime, found, deleteTime,
+               root == NULL ? "" : " (tree not empty!)");
+        freeTree(&pool, root);
+    }
+    nodePoolDestroy(&pool);
+    free(keys);
+}
+
+// Compares pointer search with both snapshot layouts on n random keys
+void runSnapshotBenchmark(int n, int queries) {
+    if (n < 1 || queries < 1) {
+        printf("Key and query counts must be positive.\n");
+        return;
+    }
+    int* probe = (int*)malloc(queries * sizeof(int));
+    if (probe == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
     }
+    unsigned int seed = 99;
+    BSTree tree = BSTREE_INIT;
+    int* inserted = (int*)malloc(n * sizeof(int));
+    if (inserted == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        inserted[i] = (int)(seed >> 1);
+        treeInsert(&tree, inserted[i]);
+    }
+    // Half the probes hit, half are random (mostly misses)
+    for (int i = 0; i < queries; i++) {
+        seed = seed * 1103515245u + 12345u;
+        probe[i] = (i & 1) ? (int)(seed >> 1) : inserted[(seed >> 4) % (unsigned int)n];
+    }
+    free(inserted);
+
+    long long found = 0;
+    double t = nowSeconds();
+    for (int i = 0; i < queries; i++) {
+        found += search(tree.root, probe[i]) != NULL;
+    }
+    double pointerTime = nowSeconds() - t;
+
+    Snapshot snap;
+    initSnapshot(&snap, &tree, 1);
+    t = nowSeconds();
+    freeze(&snap);
+    double freezeTime = nowSeconds() - t;
+
+    long long foundE = 0, foundB = 0;
+    t = nowSeconds();
+    for (int i = 0; i < queries; i++) {
+        foundE += eytzingerSearch(&snap, probe[i]) != NULL;
+    }
+    double eytzingerTime = nowSeconds() - t;
+    t = nowSeconds();
+    for (int i = 0; i < queries; i++) {
+        foundB += blockSearch(&snap, probe[i]) != NULL;
+    }
+    double blockTime = nowSeconds() - t;
+
+    printf("%d keys (%d distinct), %d queries, freeze %.3f s\n", n, sizeOf(tree.root), queries, freezeTime);
+    printf("  pointer   : %6.1f ns/query (%lld found)\n", pointerTime / queries * 1e9, found);
+    printf("  eytzinger : %6.1f ns/query (%lld found)\n", eytzingerTime / queries * 1e9, foundE);
+    printf("  block     : %6.1f ns/query (%lld found)\n", blockTime / queries * 1e9, foundB);
+
+    freeSnapshot(&snap);
+    treeDestroy(&tree);
+    free(probe);
 }
 
-int main() {
+// Usage: BST [bench <keys> | adversarial <keys> | snapshot <keys> <queries>]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runChurnBenchmark(atoi(argv[2]));
+        return 0;
+    }
+    if (argc >= 3 && strcmp(argv[1], "adversarial") == 0) {
+        runAdversarialBenchmark(atoi(argv[2]));
+        return 0;
+    }
+    if (argc >= 4 && strcmp(argv[1], "snapshot") == 0) {
+        runSnapshotBenchmark(atoi(argv[2]), atoi(argv[3]));
+        return 0;
+    }
+
+    NodePool pool = NODE_POOL_INIT(sizeof(Node));
     Node* root = NULL;
 
-    root = insert(root, 50);
-    insert(root, 30);
-    insert(root, 20);
-    insert(root, 40);
-    insert(root, 70);
-    insert(root, 60);
-    insert(root, 80);
+    root = insert(&pool, root, 50);
+    insert(&pool, root, 30);
+    insert(&pool, root, 20);
+    insert(&pool, root, 40);
+    insert(&pool, root, 70);
+    insert(&pool, root, 60);
+    insert(&pool, root, 80);
 
     printf("In-order traversal: ");
     inorder(root);
@@ -106,17 +660,40 @@ int main() {
     printf("\nSearching for 40: %s\n", search(root, 40) ? "Found" : "Not Found");
     printf("Searching for 99: %s\n", search(root, 99) ? "Found" : "Not Found");
 
-    root = deleteNode(root, 50);
+    printf("\n3rd smallest key: %d\n", selectKth(root, 3)->data);
+    printf("Keys below 65: %d\n", rank(root, 65));
+    printf("Keys in [30, 60]: %d\n", countRange(root, 30, 60));
+
+    root = deleteNode(&pool, root, 50);
     printf("\nAfter deleting 50: ");
     inorder(root);
     printf("\n");
 
-    root = deleteNode(root, 20);
+    root = deleteNode(&pool, root, 20);
     printf("After deleting 20: ");
     inorder(root);
     printf("\n");
-    
-    // Note: A function to free the entire tree memory is a good practice for real applications.
 
+    freeTree(&pool, root);
+    nodePoolDestroy(&pool);
+
+    // Snapshots follow their own tree only
+    BSTree a = BSTREE_INIT, b = BSTREE_INIT;
+    for (int key = 10; key <= 90; key += 10) {
+        treeInsert(&a, key);
+        treeInsert(&b, key + 5);
+    }
+    Snapshot snap;
+    initSnapshot(&snap, &a, 1);
+    printf("\nSnapshot of tree A, search for 60: %s\n", snapshotSearch(&snap, 60) ? "Found" : "Not Found");
+    treeInsert(&b, 100);
+    printf("Tree B changed, snapshot of A still current: %s\n",
+           snap.version == a.version ? "yes" : "no");
+    treeDelete(&a, 60);
+    printf("After deleting 60 from A, search for 60: %s\n",
+           snapshotSearch(&snap, 60) ? "Found" : "Not Found");
+    freeSnapshot(&snap);
+    treeDestroy(&a);
+    treeDestroy(&b);
     return 0;
 }
\ No newline at end of file
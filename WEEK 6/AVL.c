@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include "../WEEK 5/Node_Pool.h"
 
 // AVL Tree Node Structure
 typedef struct AVLNode {
@@ -13,21 +14,21 @@ typedef struct AVLNode {
 // Function prototypes
 int getHeight(AVLNode* node);
 int max(int a, int b);
-AVLNode* createNode(int data);
+AVLNode* createNode(NodePool* pool, int data);
 int getBalance(AVLNode* node);
 AVLNode* rightRotate(AVLNode* y);
 AVLNode* leftRotate(AVLNode* x);
-AVLNode* insert(AVLNode* node, int data);
+AVLNode* insert(NodePool* pool, AVLNode* node, int data);
 AVLNode* minValueNode(AVLNode* node);
 AVLNode* maxValueNode(AVLNode* node);
-AVLNode* deleteNode(AVLNode* root, int data);
+AVLNode* deleteNode(NodePool* pool, AVLNode* root, int data);
 AVLNode* search(AVLNode* root, int data);
 void inorderTraversal(AVLNode* root);
 void preorderTraversal(AVLNode* root);
 void postorderTraversal(AVLNode* root);
 void levelOrderTraversal(AVLNode* root);
 void printTree(AVLNode* root, int space);
-void freeTree(AVLNode* root);
+void freeTree(NodePool* pool, AVLNode* root);
 int countNodes(AVLNode* root);
 int countLeafNodes(AVLNode* root);
 int countInternalNodes(AVLNode* root);
@@ -40,13 +41,14 @@ AVLNode* findPredecessor(AVLNode* root, int data);
 AVLNode* findSuccessor(AVLNode* root, int data);
 void printRangeValues(AVLNode* root, int min, int max);
 void mirrorTree(AVLNode* root);
-AVLNode* copyTree(AVLNode* root);
+AVLNode* copyTree(NodePool* pool, AVLNode* root);
 void printMenu();
 void clearScreen();
 
 // Global variables
 AVLNode* root = NULL;
 int nodeCount = 0;
+static NodePool treePool = NODE_POOL_INIT(sizeof(AVLNode)); // nodes of root only
 
 // Function to get the height of a node
 int getHeight(AVLNode* node) {
@@ -61,8 +63,8 @@ int max(int a, int b) {
 }
 
 // Function to create a new AVL tree node
-AVLNode* createNode(int data) {
-    AVLNode* node = (AVLNode*)malloc(sizeof(AVLNode));
+AVLNode* createNode(NodePool* pool, int data) {
+    AVLNode* node = (AVLNode*)nodePoolAlloc(pool);
     node->data = data;
     node->left = NULL;
     node->right = NULL;
@@ -106,16 +108,16 @@ AVLNode* leftRotate(AVLNode* x) {
 }
 
 // Insert a node into AVL tree
-AVLNode* insert(AVLNode* node, int data) {
+AVLNode* insert(NodePool* pool, AVLNode* node, int data) {
     if (node == NULL) {
         nodeCount++;
-        return createNode(data);
+        return createNode(pool, data);
     }
     
     if (data < node->data)
-        node->left = insert(node->left, data);
+        node->left = insert(pool, node->left, data);
     else if (data > node->data)
-        node->right = insert(node->right, data);
+        node->right = insert(pool, node->right, data);
     else
         return node; // Duplicate values not allowed
     
@@ -162,14 +164,14 @@ AVLNode* maxValueNode(AVLNode* node) {
 }
 
 // Delete a node from AVL tree
-AVLNode* deleteNode(AVLNode* root, int data) {
+AVLNode* deleteNode(NodePool* pool, AVLNode* root, int data) {
     if (root == NULL)
         return root;
     
     if (data < root->data)
-        root->left = deleteNode(root->left, data);
+        root->left = deleteNode(pool, root->left, data);
     else if (data > root->data)
-        root->right = deleteNode(root->right, data);
+        root->right = deleteNode(pool, root->right, data);
     else {
         nodeCount--;
         if ((root->left == NULL) || (root->right == NULL)) {
@@ -180,11 +182,11 @@ AVLNode* deleteNode(AVLNode* root, int data) {
             } else {
                 *root = *temp;
             }
-            free(temp);
+            nodePoolFree(pool, temp);
         } else {
             AVLNode* temp = minValueNode(root->right);
             root->data = temp->data;
-            root->right = deleteNode(root->right, temp->data);
+            root->right = deleteNode(pool, root->right, temp->data);
             nodeCount++; // Compensate for the extra decrement
         }
     }
@@ -428,25 +430,31 @@ void mirrorTree(AVLNode* root) {
     mirrorTree(root->right);
 }
 
-// Copy tree
-AVLNode* copyTree(AVLNode* root) {
+// Copy tree into pool, which should be the copy's own so it can be freed alone
+AVLNode* copyTree(NodePool* pool, AVLNode* root) {
     if (root == NULL) return NULL;
     
-    AVLNode* newNode = createNode(root->data);
+    AVLNode* newNode = createNode(pool, root->data);
     newNode->height = root->height;
-    newNode->left = copyTree(root->left);
-    newNode->right = copyTree(root->right);
+    newNode->left = copyTree(pool, root->left);
+    newNode->right = copyTree(pool, root->right);
     
     return newNode;
 }
 
-// Free tree memory
-void freeTree(AVLNode* root) {
+// Free tree memory: one O(1) reset of the tree's own pool, or node by
+// node in the NODE_POOL_MALLOC build
+void freeTree(NodePool* pool, AVLNode* root) {
+#ifdef NODE_POOL_MALLOC
     if (root != NULL) {
-        freeTree(root->left);
-        freeTree(root->right);
-        free(root);
+        freeTree(pool, root->left);
+        freeTree(pool, root->right);
+        nodePoolFree(pool, root);
     }
+#else
+    (void)root;
+    nodePoolReset(pool);
+#endif
 }
 
 // Clear screen (cross-platform)
@@ -500,7 +508,7 @@ int main() {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                root = insert(root, value);
+                root = insert(&treePool, root, value);
                 printf("✓ Value %d inserted successfully!\n", value);
                 break;
                 
@@ -512,7 +520,7 @@ int main() {
                 printf("Enter value to delete: ");
                 scanf("%d", &value);
                 if (search(root, value)) {
-                    root = deleteNode(root, value);
+                    root = deleteNode(&treePool, root, value);
                     printf("✓ Value %d deleted successfully!\n", value);
                 } else {
                     printf("❌ Value %d not found in tree!\n", value);
@@ -729,7 +737,7 @@ int main() {
                 for (int i = 0; i < value; i++) {
                     int val;
                     scanf("%d", &val);
-                    root = insert(root, val);
+                    root = insert(&treePool, root, val);
                 }
                 printf("✓ %d values inserted successfully!\n", value);
                 break;
@@ -742,7 +750,7 @@ int main() {
                     int val;
                     scanf("%d", &val);
                     if (search(root, val)) {
-                        root = deleteNode(root, val);
+                        root = deleteNode(&treePool, root, val);
                     }
                 }
                 printf("✓ Bulk deletion completed!\n");
@@ -750,7 +758,7 @@ int main() {
                 
             case 25:
                 if (root != NULL) {
-                    freeTree(root);
+                    freeTree(&treePool, root);
                     root = NULL;
                     nodeCount = 0;
                     printf("🗑️  Tree cleared successfully!\n");
@@ -764,7 +772,7 @@ int main() {
                 int sampleData[] = {50, 25, 75, 10, 30, 60, 80, 5, 15, 27, 35};
                 int sampleSize = sizeof(sampleData) / sizeof(sampleData[0]);
                 for (int i = 0; i < sampleSize; i++) {
-                    root = insert(root, sampleData[i]);
+                    root = insert(&treePool, root, sampleData[i]);
                 }
                 printf("✓ Sample data loaded successfully!\n");
                 break;
@@ -783,8 +791,9 @@ int main() {
                 
             case 0:
                 if (root != NULL) {
-                    freeTree(root);
+                    freeTree(&treePool, root);
                 }
+                nodePoolDestroy(&treePool);
                 printf("\n👋 Thank you for using AVL Tree Manager!\n");
                 printf("💾 All memory freed successfully. Goodbye!\n");
                 return 0;
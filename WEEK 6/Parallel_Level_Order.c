@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+// AVL Tree Node Structure
+typedef struct AVLNode {
+    int data;
+    struct AVLNode* left;
+    struct AVLNode* right;
+    int height;
+} AVLNode;
+
+// Level order output: level i occupies values[levelOffsets[i] .. levelOffsets[i + 1])
+typedef struct {
+    int* values;
+    long* levelOffsets;
+    int levels;
+    long count;
+} LevelOrderResult;
+
+// Reusable barrier (pthread_barrier_t is not available everywhere)
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int threads;
+    int waiting;
+    unsigned long generation;
+} Barrier;
+
+// Children found by one thread in its slice of the frontier
+typedef struct {
+    AVLNode** items;
+    long count;
+    long capacity;
+    long offset; // position of this buffer in the next frontier
+} ChildBuffer;
+
+// State shared by all threads of one traversal
+typedef struct {
+    int numThreads;
+    Barrier barrier;
+    ChildBuffer* buffers;
+    AVLNode** order;   // every visited node, level by level
+    long orderCapacity;
+    int* values;
+    long levelStart;   // current frontier is order[levelStart .. levelEnd)
+    long levelEnd;
+    long* levelOffsets;
+    int levels;
+    int levelsCapacity;
+    bool done;
+} BFSState;
+
+typedef struct {
+    BFSState* state;
+    int id;
+} ThreadArg;
+
+// --- Barrier ---
+
+void barrierInit(Barrier* b, int threads) {
+    pthread_mutex_init(&b->lock, NULL);
+    pthread_cond_init(&b->cond, NULL);
+    b->threads = threads;
+    b->waiting = 0;
+    b->generation = 0;
+}
+
+void barrierWait(Barrier* b) {
+    pthread_mutex_lock(&b->lock);
+    unsigned long gen = b->generation;
+    if (++b->waiting == b->threads) {
+        b->waiting = 0;
+        b->generation++;
+        pthread_cond_broadcast(&b->cond);
+    } else {
+        while (gen == b->generation) {
+            pthread_cond_wait(&b->cond, &b->lock);
+        }
+    }
+    pthread_mutex_unlock(&b->lock);
+}
+
+void barrierDestroy(Barrier* b) {
+    pthread_mutex_destroy(&b->lock);
+    pthread_cond_destroy(&b->cond);
+}
+
+// --- Helpers ---
+
+void* xrealloc(void* p, size_t size) {
+    p = realloc(p, size);
+    if (p == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    return p;
+}
+
+void appendChild(ChildBuffer* buf, AVLNode* node) {
+    if (buf->count == buf->capacity) {
+        buf->capacity = buf->capacity ? buf->capacity * 2 : 256;
+        buf->items = (AVLNode**)xrealloc(buf->items, buf->capacity * sizeof(AVLNode*));
+    }
+    buf->items[buf->count++] = node;
+}
+
+// Slice [*from, *to) of a frontier of size m for thread id
+void sliceOf(long m, int id, int numThreads, long* from, long* to) {
+    *from = m * id / numThreads;
+    *to = m * (id + 1) / numThreads;
+}
+
+// --- Level-synchronous parallel BFS ---
+// Per level: (1) each thread expands its slice of the frontier into a
+// private buffer, (2) thread 0 turns the buffer sizes into offsets with a
+// prefix sum and grows the output, (3) each thread copies its children to
+// its offset and writes the values of its slice. Slices and offsets depend
+// only on the frontier, so the output is identical for any thread count.
+void* bfsWorker(void* arg) {
+    BFSState* s = ((ThreadArg*)arg)->state;
+    int id = ((ThreadArg*)arg)->id;
+    ChildBuffer* mine = &s->buffers[id];
+
+    while (true) {
+        long m = s->levelEnd - s->levelStart;
+        long from, to;
+        sliceOf(m, id, s->numThreads, &from, &to);
+
+        // Phase 1: expand
+        mine->count = 0;
+        for (long i = s->levelStart + from; i < s->levelStart + to; i++) {
+            AVLNode* node = s->order[i];
+            if (node->left) appendChild(mine, node->left);
+            if (node->right) appendChild(mine, node->right);
+        }
+        barrierWait(&s->barrier);
+
+        // Phase 2: prefix sum and capacity
+        if (id == 0) {
+            long total = 0;
+            for (int t = 0; t < s->numThreads; t++) {
+                s->buffers[t].offset = total;
+                total += s->buffers[t].count;
+            }
+            long needed = s->levelEnd + total;
+            if (needed > s->orderCapacity) {
+                while (s->orderCapacity < needed) {
+                    s->orderCapacity *= 2;
+                }
+                s->order = (AVLNode**)xrealloc(s->order, s->orderCapacity * sizeof(AVLNode*));
+                s->values = (int*)xrealloc(s->values, s->orderCapacity * sizeof(int));
+            }
+            if (s->levels + 2 > s->levelsCapacity) {
+                s->levelsCapacity *= 2;
+                s->levelOffsets = (long*)xrealloc(s->levelOffsets,
+                                                  s->levelsCapacity * sizeof(long));
+            }
+            s->levels++;
+            s->levelOffsets[s->levels] = s->levelEnd;
+            s->done = (total == 0);
+        }
+        barrierWait(&s->barrier);
+
+        // Phase 3: scatter children, emit values
+        if (mine->count > 0) {
+            memcpy(s->order + s->levelEnd + mine->offset, mine->items,
+                   mine->count * sizeof(AVLNode*));
+        }
+        for (long i = s->levelStart + from; i < s->levelStart + to; i++) {
+            s->values[i] = s->order[i]->data;
+        }
+        bool done = s->done;
+        long newEnd = s->levelEnd + s->buffers[s->numThreads - 1].offset
+                      + s->buffers[s->numThreads - 1].count;
+        barrierWait(&s->barrier);
+
+        if (done) {
+            break;
+        }
+        if (id == 0) {
+            s->levelStart = s->levelEnd;
+            s->levelEnd = newEnd;
+        }
+        barrierWait(&s->barrier);
+    }
+    return NULL;
+}
+
+LevelOrderResult parallelLevelOrder(AVLNode* root, int numThreads) {
+    LevelOrderResult res = {NULL, NULL, 0, 0};
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+
+    BFSState s;
+    s.numThreads = numThreads;
+    s.orderCapacity = 1024;
+    s.order = (AVLNode**)xrealloc(NULL, s.orderCapacity * sizeof(AVLNode*));
+    s.values = (int*)xrealloc(NULL, s.orderCapacity * sizeof(int));
+    s.levelsCapacity = 64;
+    s.levelOffsets = (long*)xrealloc(NULL, s.levelsCapacity * sizeof(long));
+    s.levelOffsets[0] = 0;
+    s.levels = 0;
+    s.done = false;
+
+    if (root == NULL) {
+        free(s.order);
+        free(s.values);
+        res.levelOffsets = s.levelOffsets;
+        return res;
+    }
+
+    s.order[0] = root;
+    s.levelStart = 0;
+    s.levelEnd = 1;
+    s.buffers = (ChildBuffer*)calloc(numThreads, sizeof(ChildBuffer));
+    barrierInit(&s.barrier, numThreads);
+
+    pthread_t* threads = (pthread_t*)malloc(numThreads * sizeof(pthread_t));
+    ThreadArg* args = (ThreadArg*)malloc(numThreads * sizeof(ThreadArg));
+    for (int t = 0; t < numThreads; t++) {
+        args[t].state = &s;
+        args[t].id = t;
+        if (t > 0) {
+            pthread_create(&threads[t], NULL, bfsWorker, &args[t]);
+        }
+    }
+    bfsWorker(&args[0]);
+    for (int t = 1; t < numThreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    res.values = s.values;
+    res.levelOffsets = s.levelOffsets;
+    res.levels = s.levels;
+    res.count = s.levelOffsets[s.levels];
+
+    for (int t = 0; t < numThreads; t++) {
+        free(s.buffers[t].items);
+    }
+    free(s.buffers);
+    free(s.order);
+    free(threads);
+    free(args);
+    barrierDestroy(&s.barrier);
+    return res;
+}
+
+void freeResult(LevelOrderResult* res) {
+    free(res->values);
+    free(res->levelOffsets);
+    res->values = NULL;
+    res->levelOffsets = NULL;
+}
+
+// --- Tree building and benchmark ---
+
+AVLNode* createNode(int data) {
+    AVLNode* node = (AVLNode*)malloc(sizeof(AVLNode));
+    if (node == NULL) {
+        perror("Memory allocation failed");
+        exit(1);
+    }
+    node->data = data;
+    node->left = NULL;
+    node->right = NULL;
+    node->height = 1;
+    return node;
+}
+
+// Builds a height-balanced (hence valid AVL) tree over lo..hi
+AVLNode* buildBalanced(int lo, int hi) {
+    if (lo > hi) return NULL;
+    int mid = lo + (hi - lo) / 2;
+    AVLNode* node = createNode(mid);
+    node->left = buildBalanced(lo, mid - 1);
+    node->right = buildBalanced(mid + 1, hi);
+    int lh = node->left ? node->left->height : 0;
+    int rh = node->right ? node->right->height : 0;
+    node->height = 1 + (lh > rh ? lh : rh);
+    return node;
+}
+
+void freeTree(AVLNode* root) {
+    if (root != NULL) {
+        freeTree(root->left);
+        freeTree(root->right);
+        free(root);
+    }
+}
+
+// Sequential reference: one queue, one node at a time
+long sequentialLevelOrder(AVLNode* root, AVLNode** queue, int* out) {
+    long front = 0, rear = 0;
+    queue[rear++] = root;
+    while (front < rear) {
+        AVLNode* current = queue[front];
+        out[front++] = current->data;
+        if (current->left) queue[rear++] = current->left;
+        if (current->right) queue[rear++] = current->right;
+    }
+    return rear;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void runBenchmark(int n, int maxThreads) {
+    AVLNode* root = buildBalanced(1, n);
+    AVLNode** queue = (AVLNode**)malloc((size_t)n * sizeof(AVLNode*));
+    int* expected = (int*)malloc((size_t)n * sizeof(int));
+
+    double t = nowSeconds();
+    sequentialLevelOrder(root, queue, expected);
+    double base = nowSeconds() - t;
+    printf("Sequential   : %.3f s\n", base);
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        t = nowSeconds();
+        LevelOrderResult res = parallelLevelOrder(root, threads);
+        double elapsed = nowSeconds() - t;
+        bool same = res.count == n && memcmp(res.values, expected, (size_t)n * sizeof(int)) == 0;
+        printf("%2d thread(s) : %.3f s  speedup %.2fx  %s\n", threads, elapsed,
+               base / elapsed, same ? "output matches" : "OUTPUT DIFFERS");
+        freeResult(&res);
+    }
+
+    free(queue);
+    free(expected);
+    freeTree(root);
+}
+
+// Usage: Parallel_Level_Order [bench <nodes> [max threads]]
+int main(int argc, char* argv[]) {
+    if (argc >= 3 && strcmp(argv[1], "bench") == 0) {
+        runBenchmark(atoi(argv[2]), argc >= 4 ? atoi(argv[3]) : 8);
+        return 0;
+    }
+
+    AVLNode* root = buildBalanced(1, 15);
+    LevelOrderResult res = parallelLevelOrder(root, 4);
+    printf("Level Order Traversal:\n");
+    for (int level = 0; level < res.levels; level++) {
+        printf("  Level %d: ", level);
+        for (long i = res.levelOffsets[level]; i < res.levelOffsets[level + 1]; i++) {
+            printf("%d ", res.values[i]);
+        }
+        printf("\n");
+    }
+    freeResult(&res);
+    freeTree(root);
+    return 0;
+}
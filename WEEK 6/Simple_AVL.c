@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "../WEEK 5/Node_Pool.h"
 
 // AVL Tree Node Structure
 typedef struct Node {
@@ -24,8 +25,8 @@ int max(int a, int b) {
 }
 
 // Create a new node
-Node *createNode(int data) {
-    Node *node = (Node *)malloc(sizeof(Node));
+Node *createNode(NodePool *pool, int data) {
+    Node *node = (Node *)nodePoolAlloc(pool);
     node->data = data;
     node->left = NULL;
     node->right = NULL;
@@ -78,16 +79,16 @@ Node *leftRotate(Node *x) {
 
 // --- Core AVL Operations ---
 
-// Insert a node into the AVL tree
-Node *insert(Node *node, int data) {
+// Insert a node into the AVL tree; new nodes come from the tree's pool
+Node *insert(NodePool *pool, Node *node, int data) {
     // 1. Perform standard BST insertion
     if (node == NULL)
-        return createNode(data);
+        return createNode(pool, data);
 
     if (data < node->data)
-        node->left = insert(node->left, data);
+        node->left = insert(pool, node->left, data);
     else if (data > node->data)
-        node->right = insert(node->right, data);
+        node->right = insert(pool, node->right, data);
     else // Duplicate data not allowed
         return node;
 
@@ -132,15 +133,15 @@ Node *minValueNode(Node *node) {
 }
 
 // Delete a node from the AVL tree
-Node *deleteNode(Node *root, int data) {
+Node *deleteNode(NodePool *pool, Node *root, int data) {
     // 1. Perform standard BST delete
     if (root == NULL)
         return root;
 
     if (data < root->data)
-        root->left = deleteNode(root->left, data);
+        root->left = deleteNode(pool, root->left, data);
     else if (data > root->data)
-        root->right = deleteNode(root->right, data);
+        root->right = deleteNode(pool, root->right, data);
     else {
         // Node with only one child or no child
         if ((root->left == NULL) || (root->right == NULL)) {
@@ -151,12 +152,12 @@ Node *deleteNode(Node *root, int data) {
             } else { // One child case
                 *root = *temp;
             }
-            free(temp);
+            nodePoolFree(pool, temp);
         } else {
             // Node with two children: Get the inorder successor
             Node *temp = minValueNode(root->right);
             root->data = temp->data;
-            root->right = deleteNode(root->right, temp->data);
+            root->right = deleteNode(pool, root->right, temp->data);
         }
     }
 
@@ -214,10 +215,26 @@ void inorderTraversal(Node *root) {
     }
 }
 
+// Free the whole tree. Its pool holds nothing else, so this is one O(1)
+// reset; the malloc build frees each node (the height is logarithmic)
+void freeTree(NodePool *pool, Node *root) {
+#ifdef NODE_POOL_MALLOC
+    if (root != NULL) {
+        freeTree(pool, root->left);
+        freeTree(pool, root->right);
+        nodePoolFree(pool, root);
+    }
+#else
+    (void)root;
+    nodePoolReset(pool);
+#endif
+}
+
 
 // --- Main Function with Menu ---
 
 int main() {
+    NodePool pool = NODE_POOL_INIT(sizeof(Node)); // this tree's nodes only
     Node *root = NULL;
     int choice, value;
 
@@ -235,7 +252,7 @@ int main() {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                root = insert(root, value);
+                root = insert(&pool, root, value);
                 printf("Value %d inserted.\n", value);
                 break;
 
@@ -243,7 +260,7 @@ int main() {
                 printf("Enter value to delete: ");
                 scanf("%d", &value);
                 if (search(root, value)) {
-                     root = deleteNode(root, value);
+                     root = deleteNode(&pool, root, value);
                      printf("Value %d deleted.\n", value);
                 } else {
                      printf("Value %d not found in the tree.\n", value);
@@ -271,7 +288,8 @@ int main() {
 
             case 5:
                 printf("Exiting program.\n");
-                // Note: A complete program should free all nodes before exiting.
+                freeTree(&pool, root);
+                nodePoolDestroy(&pool);
                 exit(0);
 
             default: